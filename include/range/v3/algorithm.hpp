@@ -26,8 +26,10 @@
 #include <range/v3/algorithm/copy_n.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/dary_heap_algorithm.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/equal_range_many.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/find.hpp>
 #include <range/v3/algorithm/find_end.hpp>
@@ -42,6 +44,7 @@
 #include <range/v3/algorithm/is_partitioned.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
 #include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/lower_bound_many.hpp>
 #include <range/v3/algorithm/max_element.hpp>
 #include <range/v3/algorithm/merge.hpp>
 #include <range/v3/algorithm/merge_move.hpp>
@@ -73,12 +76,15 @@
 #include <range/v3/algorithm/rotate_copy.hpp>
 #include <range/v3/algorithm/search.hpp>
 #include <range/v3/algorithm/search_n.hpp>
+#include <range/v3/algorithm/searchers.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/sort_permute.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include <range/v3/algorithm/swap_ranges.hpp>
+#include <range/v3/algorithm/top_k.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/algorithm/unique.hpp>
 #include <range/v3/algorithm/unique_copy.hpp>
@@ -91,6 +97,7 @@
 #include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/sort_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/upper_bound_n.hpp>
+#include <range/v3/utility/parallel.hpp>
 
 #include <range/v3/detail/re_enable_warnings.hpp>
 
@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -53,6 +54,36 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Tests the elements in parallel; the threads stop as soon as one of
+            /// them finds an element that does not satisfy the predicate.
+            template<typename I, typename S, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokablePredicate<F, Project<I, P>>>())>
+            bool
+            operator()(parallel_policy const &policy, I first, S last_, F pred, P proj = P{}) const
+            {
+                auto &&ipred = invokable(pred);
+                auto &&iproj = invokable(proj);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(first, last_) - first;
+                return n == detail::parallel_find_first(policy, n, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        if(!ipred(iproj(*(first + lo))))
+                            break;
+                    return lo;
+                });
+            }
+
+            template<typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() && IndirectInvokablePredicate<F, Project<I, P>>())>
+            bool
+            operator()(parallel_policy const &policy, Rng &&rng, F pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `all_of_fn`
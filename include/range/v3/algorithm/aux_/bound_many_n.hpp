@@ -0,0 +1,158 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_BOUND_MANY_N_HPP
+#define RANGES_V3_ALGORITHM_AUX_BOUND_MANY_N_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/lower_bound_n.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \ingroup group-concepts
+        template<typename I, typename Q, typename C = ordered_less, typename P = ident>
+        using BinarySearchableMany = meta::fast_and<
+            RandomAccessIterator<I>,
+            InputIterator<Q>,
+            BinarySearchable<I, iterator_value_t<Q>, C, P>,
+            Constructible<iterator_value_t<Q>, iterator_reference_t<Q>>>;
+
+        namespace aux
+        {
+            // The searches below are expressed in terms of a binary "before"
+            // predicate: before(x, q) is true when the element x is before the
+            // position sought for the query q. For lower bounds, before(x, q) is
+            // pred(proj(x), q); for upper bounds, it is !pred(q, proj(x)).
+
+            // Number of queries searched for together by interleaved_bound_n.
+            constexpr std::ptrdiff_t bound_many_batch_size = 16;
+
+            // Branchless search for the first position in [begin, begin + d) that
+            // is not before q.
+            template<typename I, typename Q, typename Before>
+            I bound_n(I begin, iterator_difference_t<I> d, Q const &q, Before &before)
+            {
+                if(0 == d)
+                    return begin;
+                while(d > 1)
+                {
+                    auto half = d / 2;
+                    begin = before(*(begin + half), q) ? begin + half : begin;
+                    d -= half;
+                }
+                return before(*begin, q) ? begin + 1 : begin;
+            }
+
+            // Exponential search forward from begin. Costs O(log k) compares when
+            // the answer is k elements away, so a sequence of sorted queries costs
+            // no more than a merge when they are dense in the haystack, and no
+            // more than independent binary searches when they are sparse.
+            template<typename I, typename Q, typename Before>
+            I gallop_n(I begin, iterator_difference_t<I> d, Q const &q, Before &before)
+            {
+                iterator_difference_t<I> bound = 1;
+                while(bound <= d && before(*(begin + (bound - 1)), q))
+                    bound *= 2;
+                auto const lo = bound / 2;
+                auto const hi = (std::min)(bound - 1, d);
+                return aux::bound_n(begin + lo, hi - lo, q, before);
+            }
+
+            // Runs the branchless searches for all of [qbegin, qend) in lockstep.
+            // Every search over the same range takes the same number of steps, so
+            // one step of each can be issued before the first one's load has
+            // completed, and the memory latency of the searches overlaps.
+            template<typename I, typename Q, typename Before>
+            void interleaved_bound_n(I begin, iterator_difference_t<I> d, Q const *qbegin,
+                Q const *qend, I *out, Before &before)
+            {
+                std::ptrdiff_t const m = qend - qbegin;
+                for(std::ptrdiff_t j = 0; j < m; ++j)
+                    out[j] = begin;
+                if(0 == d)
+                    return;
+                while(d > 1)
+                {
+                    auto half = d / 2;
+                    if(d > detail::binary_search_prefetch_threshold)
+                        for(std::ptrdiff_t j = 0; j < m; ++j)
+                        {
+                            detail::prefetch(out[j] + half / 2);
+                            detail::prefetch(out[j] + (half + half / 2));
+                        }
+                    for(std::ptrdiff_t j = 0; j < m; ++j)
+                        out[j] = before(*(out[j] + half), *(qbegin + j)) ? out[j] + half : out[j];
+                    d -= half;
+                }
+                for(std::ptrdiff_t j = 0; j < m; ++j)
+                    out[j] = before(*out[j], *(qbegin + j)) ? out[j] + 1 : out[j];
+            }
+
+            // Calls sink(bound, query) for each query in [qbegin, qend), in order,
+            // where bound is the first position in [begin, end) not before it.
+            // Queries are read in batches. A batch whose queries are sorted, and
+            // not less than the previous batch's, is searched for by galloping
+            // forward from the previous answer; any other batch by interleaved
+            // searches over the whole haystack.
+            template<typename I, typename QI, typename QS, typename C, typename Before,
+                typename Sink>
+            QI bound_many(I begin, I end, QI qbegin, QS qend, C &pred, Before &before,
+                Sink &sink)
+            {
+                using Q = iterator_value_t<QI>;
+                std::vector<Q> batch, prev_batch;
+                batch.reserve(bound_many_batch_size);
+                prev_batch.reserve(bound_many_batch_size);
+                I hits[bound_many_batch_size];
+                I prev = begin;
+                while(qbegin != qend)
+                {
+                    batch.clear();
+                    for(; qbegin != qend &&
+                        static_cast<std::ptrdiff_t>(batch.size()) < bound_many_batch_size; ++qbegin)
+                        batch.emplace_back(*qbegin);
+                    std::ptrdiff_t const m = static_cast<std::ptrdiff_t>(batch.size());
+                    bool sorted = prev_batch.empty() || !pred(batch[0], prev_batch.back());
+                    for(std::ptrdiff_t j = 1; sorted && j < m; ++j)
+                        sorted = !pred(batch[j], batch[j - 1]);
+                    if(sorted)
+                    {
+                        for(std::ptrdiff_t j = 0; j < m; ++j)
+                            prev = hits[j] = aux::gallop_n(prev, end - prev, batch[j], before);
+                    }
+                    else
+                    {
+                        aux::interleaved_bound_n(begin, end - begin, batch.data(),
+                            batch.data() + m, hits, before);
+                        prev = hits[m - 1];
+                    }
+                    for(std::ptrdiff_t j = 0; j < m; ++j)
+                        sink(hits[j], batch[j]);
+                    batch.swap(prev_batch);
+                }
+                return qbegin;
+            }
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,313 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_COMPACT_N_HPP
+#define RANGES_V3_ALGORITHM_AUX_COMPACT_N_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename O, typename V>
+            struct is_compressible_
+              : meta::and_<
+                    meta::or_<
+                        std::is_same<I, V *>,
+                        std::is_same<I, V const *>,
+                        std::is_same<I, typename std::vector<V>::iterator>,
+                        std::is_same<I, typename std::vector<V>::const_iterator>>,
+                    meta::or_<
+                        std::is_same<O, V *>,
+                        std::is_same<O, typename std::vector<V>::iterator>>>
+            {};
+
+            // Whether I and O are pointers or vector iterators to the same
+            // arithmetic type, so that elements can be copied as bytes. Not
+            // bool, whose vector packs its elements into bits.
+            template<typename I, typename O, typename V = iterator_value_t<I>>
+            using is_compressible = meta::and_<
+                std::is_arithmetic<V>,
+                meta::not_<std::is_same<V, bool>>,
+                meta::if_<std::is_arithmetic<V>, is_compressible_<I, O, V>, std::false_type>>;
+
+            inline int popcount64(std::uint64_t x)
+            {
+            #if defined(__clang__) || defined(__GNUC__)
+                return __builtin_popcountll(x);
+            #else
+                x = x - ((x >> 1) & 0x5555555555555555ull);
+                x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+                x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+                return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+            #endif
+            }
+
+            // The position of the lowest set bit of x, which is not 0
+            inline int countr_zero64(std::uint64_t x)
+            {
+            #if defined(__clang__) || defined(__GNUC__)
+                return __builtin_ctzll(x);
+            #else
+                int n = 0;
+                for(; 0 == (x & 1u); x >>= 1)
+                    ++n;
+                return n;
+            #endif
+            }
+        }
+        /// \endcond
+
+        namespace aux
+        {
+            // Stands in for the output of the elements that an algorithm drops
+            struct no_output
+            {
+                template<typename D>
+                no_output operator+(D) const
+                {
+                    return {};
+                }
+            };
+
+            // Elements are classified 64 at a time, into a word with a bit set
+            // for each element that satisfies the predicate.
+            constexpr std::ptrdiff_t compact_block_size = 64;
+
+            template<typename I, typename C, typename P>
+            std::uint64_t predicate_mask(I begin, std::ptrdiff_t n, C &pred, P &proj)
+            {
+                std::uint64_t mask = 0;
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    mask |= static_cast<std::uint64_t>(!!pred(proj(*(begin + i)))) << i;
+                return mask;
+            }
+
+            // Copies the elements of [begin, begin + n) whose bits are set in
+            // mask to out, in order.
+            template<typename I, typename O>
+            O mask_compress_(I begin, std::ptrdiff_t, std::uint64_t mask, O out, std::false_type)
+            {
+                for(; 0 != mask; mask &= mask - 1, ++out)
+                    *out = *(begin + detail::countr_zero64(mask));
+                return out;
+            }
+
+            template<typename I, typename O>
+            O mask_compress_(I begin, std::ptrdiff_t n, std::uint64_t mask, O out, std::true_type)
+            {
+                using T = uncvref_t<decltype(*begin)>;
+                T const *src = &*begin;
+                if(compact_block_size == n)
+                {
+                    if(~std::uint64_t(0) == mask)
+                    {
+                        std::memcpy(&*out, src, sizeof(T) * compact_block_size);
+                        return out + compact_block_size;
+                    }
+                #if defined(__AVX512F__)
+                    if(4 == sizeof(T) || 8 == sizeof(T))
+                    {
+                        // The masked compressing store writes just the selected
+                        // lanes, packed, to consecutive addresses.
+                        int const lanes = static_cast<int>(64 / sizeof(T));
+                        for(int i = 0; i < compact_block_size; i += lanes, mask >>= lanes)
+                        {
+                            __m512i const v =
+                                _mm512_loadu_si512(static_cast<void const *>(src + i));
+                            void *dst = static_cast<void *>(&*out);
+                            if(4 == sizeof(T))
+                            {
+                                __mmask16 const m = static_cast<__mmask16>(mask);
+                                _mm512_mask_compressstoreu_epi32(dst, m, v);
+                                out += detail::popcount64(m);
+                            }
+                            else
+                            {
+                                __mmask8 const m = static_cast<__mmask8>(mask);
+                                _mm512_mask_compressstoreu_epi64(dst, m, v);
+                                out += detail::popcount64(m);
+                            }
+                        }
+                        return out;
+                    }
+                #endif
+                    if(detail::popcount64(mask) >= 40)
+                    {
+                        // Too many set bits to visit one at a time: store every
+                        // element to a buffer, advancing past the selected ones.
+                        T buf[compact_block_size];
+                        int j = 0;
+                        for(int i = 0; i < compact_block_size; ++i)
+                        {
+                            buf[j] = src[i];
+                            j += static_cast<int>((mask >> i) & 1u);
+                        }
+                        std::memcpy(&*out, buf, sizeof(T) * static_cast<std::size_t>(j));
+                        return out + j;
+                    }
+                }
+                return aux::mask_compress_(src, n, mask, out, std::false_type{});
+            }
+
+            template<typename I, typename O>
+            O mask_compress(I begin, std::ptrdiff_t n, std::uint64_t mask, O out)
+            {
+                return aux::mask_compress_(begin, n, mask, out, detail::is_compressible<I, O>{});
+            }
+
+            template<typename I>
+            no_output mask_compress(I, std::ptrdiff_t, std::uint64_t, no_output)
+            {
+                return {};
+            }
+
+            // Copies each element of [begin, begin + n) to out_true if its bit
+            // is set in mask, and to out_false otherwise.
+            template<typename I, typename OT, typename OF>
+            void compact_block(I begin, std::ptrdiff_t n, std::uint64_t mask, OT &out_true,
+                OF &out_false)
+            {
+                std::uint64_t const all = compact_block_size == n ?
+                    ~std::uint64_t(0) : (std::uint64_t(1) << n) - 1;
+                out_true = aux::mask_compress(begin, n, mask, out_true);
+                out_false = aux::mask_compress(begin, n, ~mask & all, out_false);
+            }
+
+            // Stable stream compaction: copies the elements of [begin, begin + n)
+            // that satisfy the predicate to out_true and the others to
+            // out_false, in order, without branching on the predicate's value.
+            // Either output may be a no_output.
+            template<typename I, typename OT, typename OF, typename C, typename P>
+            std::pair<OT, OF> compact_n(I begin, iterator_difference_t<I> n, OT out_true,
+                OF out_false, C &pred, P &proj)
+            {
+                for(iterator_difference_t<I> i = 0; i < n; i += compact_block_size)
+                {
+                    std::ptrdiff_t const len = static_cast<std::ptrdiff_t>(
+                        n - i < compact_block_size ? n - i : compact_block_size);
+                    std::uint64_t const mask = aux::predicate_mask(begin + i, len, pred, proj);
+                    aux::compact_block(begin + i, len, mask, out_true, out_false);
+                }
+                return {out_true, out_false};
+            }
+
+            // The parallel stream compaction, in two passes over the same
+            // chunks of whole blocks. classify records a bit per element, and
+            // for each chunk, the number of elements before it that satisfy the
+            // predicate; scatter then copies the elements of each chunk to
+            // their places in the outputs. In between, total is the number of
+            // elements that satisfy the predicate.
+            template<typename D>
+            struct parallel_compaction
+            {
+                std::size_t chunks;
+                D n;
+                D total;
+                std::vector<std::uint64_t> masks;
+                std::vector<D> offsets;
+
+                parallel_compaction(parallel_policy const &policy, D n_)
+                  : chunks(detail::parallel_chunks(policy, n_)), n(n_), total(0)
+                  , masks(static_cast<std::size_t>((n_ + compact_block_size - 1) / compact_block_size))
+                  , offsets(chunks)
+                {}
+                // The elements of the k-th chunk
+                std::pair<D, D> bounds(std::size_t k) const
+                {
+                    auto const r = detail::static_chunk(static_cast<D>(masks.size()), chunks, k);
+                    return std::make_pair(static_cast<D>(r.first * compact_block_size),
+                        (std::min)(static_cast<D>(r.second * compact_block_size), n));
+                }
+                template<typename I, typename C, typename P>
+                void classify(parallel_policy const &policy, I begin, C &pred, P &proj)
+                {
+                    detail::parallel_for(policy, chunks, [&](std::size_t k)
+                    {
+                        auto const r = bounds(k);
+                        D count = 0;
+                        for(D i = r.first; i < r.second; i += compact_block_size)
+                        {
+                            std::ptrdiff_t const len = static_cast<std::ptrdiff_t>(
+                                (std::min)(r.second - i, D(compact_block_size)));
+                            std::uint64_t const mask =
+                                aux::predicate_mask(begin + i, len, pred, proj);
+                            masks[static_cast<std::size_t>(i / compact_block_size)] = mask;
+                            count += detail::popcount64(mask);
+                        }
+                        offsets[k] = count;
+                    });
+                    total = 0;
+                    for(auto &offset : offsets)
+                    {
+                        D const count = offset;
+                        offset = total;
+                        total += count;
+                    }
+                }
+                template<typename I, typename OT, typename OF>
+                void scatter(parallel_policy const &policy, I begin, OT out_true,
+                    OF out_false) const
+                {
+                    detail::parallel_for(policy, chunks, [&](std::size_t k)
+                    {
+                        auto const r = bounds(k);
+                        OT t = out_true + offsets[k];
+                        OF f = out_false + (r.first - offsets[k]);
+                        for(D i = r.first; i < r.second; i += compact_block_size)
+                        {
+                            std::ptrdiff_t const len = static_cast<std::ptrdiff_t>(
+                                (std::min)(r.second - i, D(compact_block_size)));
+                            aux::compact_block(begin + i, len,
+                                masks[static_cast<std::size_t>(i / compact_block_size)], t, f);
+                        }
+                    });
+                }
+            };
+
+            // Each thread classifies a run of whole blocks and counts the
+            // elements in it that satisfy the predicate; an exclusive scan of
+            // the counts gives the position in the outputs of each thread's
+            // first element; and each thread then copies its elements to their
+            // places. The predicate is called once per element, concurrently.
+            template<typename I, typename OT, typename OF, typename C, typename P>
+            std::pair<OT, OF> compact_n(parallel_policy const &policy, I begin,
+                iterator_difference_t<I> n, OT out_true, OF out_false, C &pred, P &proj)
+            {
+                if(detail::parallel_chunks(policy, n) <= 1)
+                    return aux::compact_n(begin, n, out_true, out_false, pred, proj);
+                parallel_compaction<iterator_difference_t<I>> compaction(policy, n);
+                compaction.classify(policy, begin, pred, proj);
+                compaction.scatter(policy, begin, out_true, out_false);
+                return {out_true + compaction.total, out_false + (n - compaction.total)};
+            }
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -19,6 +19,8 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -26,12 +28,52 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Binary searches over ranges larger than this fetch the two
+            // possible next midpoints while the current one is compared.
+            constexpr std::ptrdiff_t binary_search_prefetch_threshold = 1024;
+        }
+        /// \endcond
+
         namespace aux
         {
             struct lower_bound_n_fn
             {
+                // Branchless: the loop always halves the range, and selects the
+                // half with a conditional move, which the branch predictor
+                // cannot get wrong. On large ranges the elements that may be the
+                // next midpoint are prefetched to overlap cache misses.
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    if(0 == d)
+                        return begin;
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    while(d > detail::binary_search_prefetch_threshold)
+                    {
+                        auto half = d / 2;
+                        detail::prefetch(begin + half / 2);
+                        detail::prefetch(begin + (half + half / 2));
+                        begin = pred(proj(*(begin + half)), val) ? begin + half : begin;
+                        d -= half;
+                    }
+                    while(d > 1)
+                    {
+                        auto half = d / 2;
+                        begin = pred(proj(*(begin + half)), val) ? begin + half : begin;
+                        d -= half;
+                    }
+                    return pred(proj(*begin), val) ? begin + 1 : begin;
+                }
+
                 template<typename I, typename V2, typename C = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
+                    CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
                 I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
                     P proj_ = P{}) const
                 {
@@ -0,0 +1,189 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_REDUCE_N_HPP
+#define RANGES_V3_ALGORITHM_AUX_REDUCE_N_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename V>
+            struct is_contiguous_arithmetic_
+              : meta::or_<
+                    std::is_same<I, V *>,
+                    std::is_same<I, V const *>,
+                    std::is_same<I, typename std::vector<V>::iterator>,
+                    std::is_same<I, typename std::vector<V>::const_iterator>>
+            {};
+
+            // Whether I is a pointer or a vector iterator to arithmetic
+            // elements, which can be read through a plain pointer. Not bool,
+            // whose vector packs its elements into bits.
+            template<typename I, typename V = iterator_value_t<I>>
+            using is_contiguous_arithmetic = meta::and_<
+                std::is_arithmetic<V>,
+                meta::not_<std::is_same<V, bool>>,
+                meta::if_<std::is_arithmetic<V>, is_contiguous_arithmetic_<I, V>, std::false_type>>;
+
+            // Whether min_element and friends, called with C and P, may take
+            // the vectorized path for I
+            template<typename I, typename C, typename P>
+            using is_plain_extremum = meta::and_<
+                std::is_same<C, ordered_less>,
+                std::is_same<P, ident>,
+                is_contiguous_arithmetic<I>>;
+        }
+        /// \endcond
+
+        namespace aux
+        {
+            // The reductions below keep this many independent accumulators,
+            // which the compiler packs into vector registers, and go over the
+            // elements in blocks of reduce_block_size, with a lane's worth at
+            // a time.
+            constexpr std::ptrdiff_t reduce_lanes = 16;
+            constexpr std::ptrdiff_t reduce_block_size = 256;
+
+            // The number of elements of [begin, begin + n) that satisfy the
+            // predicate, counted without branching on its value. The lanes'
+            // counts are 32-bit, to match the width of int and float
+            // comparisons, and are added to the total before they can wrap.
+            template<typename I, typename C, typename P>
+            iterator_difference_t<I> count_if_n(I begin, iterator_difference_t<I> n, C &pred,
+                P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const rounds = D(1) << 12;
+                D count = 0, i = 0;
+                while(n - i >= reduce_lanes)
+                {
+                    std::uint32_t counts[reduce_lanes] = {};
+                    D const m = (std::min)((n - i) / reduce_lanes, rounds);
+                    for(D k = 0; k < m; ++k, i += reduce_lanes)
+                        for(std::ptrdiff_t j = 0; j < reduce_lanes; ++j)
+                            counts[j] += static_cast<std::uint32_t>(!!pred(proj(begin[i + j])));
+                    for(std::ptrdiff_t j = 0; j < reduce_lanes; ++j)
+                        count += static_cast<D>(counts[j]);
+                }
+                for(; i < n; ++i)
+                    count += static_cast<D>(!!pred(proj(begin[i])));
+                return count;
+            }
+
+            // The positions of the first least, and of the first (or, if
+            // LastMax, the last) greatest, of the n > 0 elements at p, for the
+            // ones that Min and Max ask for, by the order of <: those that the
+            // sequential min_element, max_element and minmax_element find.
+            //
+            // Each block's least and greatest elements are reduced lane by
+            // lane, and then across lanes; only a block whose extreme beats
+            // the best so far (or, for the last greatest, ties it) is kept,
+            // and the extreme's position is found by searching just the kept
+            // block for it, from the end that gives the required tie-break.
+            // An element that is not equal to itself, a NaN, makes < no
+            // longer an order; if there is one, returns false, and the caller
+            // falls back to comparing the elements one by one.
+            template<bool Min, bool Max, bool LastMax, typename T>
+            bool extrema_n(T const *p, std::ptrdiff_t n, std::ptrdiff_t &imin,
+                std::ptrdiff_t &imax)
+            {
+                std::ptrdiff_t const blocks = n / reduce_block_size;
+                std::ptrdiff_t bmin = 0, bmax = 0;
+                T vmin = p[0], vmax = p[0];
+                for(std::ptrdiff_t b = 0; b < blocks; ++b)
+                {
+                    T const *q = p + b * reduce_block_size;
+                    // nan keeps a NaN from each lane, if there is one; it has the
+                    // type of the elements, so that it packs into the same
+                    // vector registers as lo and hi.
+                    T lo[reduce_lanes], hi[reduce_lanes], nan[reduce_lanes];
+                    for(std::ptrdiff_t j = 0; j < reduce_lanes; ++j)
+                    {
+                        lo[j] = hi[j] = q[j];
+                        nan[j] = q[j] == q[j] ? T(0) : q[j];
+                    }
+                    for(std::ptrdiff_t i = reduce_lanes; i < reduce_block_size; i += reduce_lanes)
+                        for(std::ptrdiff_t j = 0; j < reduce_lanes; ++j)
+                        {
+                            T const x = q[i + j];
+                            if(Min)
+                                lo[j] = x < lo[j] ? x : lo[j];
+                            if(Max)
+                                hi[j] = hi[j] < x ? x : hi[j];
+                            nan[j] = x == x ? nan[j] : x;
+                        }
+                    bool any_nan = false;
+                    T l = lo[0], h = hi[0];
+                    for(std::ptrdiff_t j = 0; j < reduce_lanes; ++j)
+                    {
+                        l = lo[j] < l ? lo[j] : l;
+                        h = h < hi[j] ? hi[j] : h;
+                        any_nan = any_nan || !(nan[j] == nan[j]);
+                    }
+                    if(any_nan)
+                        return false;
+                    if(Min && (0 == b || l < vmin))
+                    {
+                        vmin = l;
+                        bmin = b;
+                    }
+                    if(Max && (0 == b || (LastMax ? !(h < vmax) : vmax < h)))
+                    {
+                        vmax = h;
+                        bmax = b;
+                    }
+                }
+                std::ptrdiff_t i = blocks * reduce_block_size;
+                if(0 == blocks)
+                    imin = imax = i++;
+                else
+                {
+                    if(Min)
+                        for(imin = bmin * reduce_block_size; !(p[imin] == vmin); ++imin)
+                            ;
+                    if(Max && LastMax)
+                        for(imax = (bmax + 1) * reduce_block_size - 1; !(p[imax] == vmax); --imax)
+                            ;
+                    else if(Max)
+                        for(imax = bmax * reduce_block_size; !(p[imax] == vmax); ++imax)
+                            ;
+                }
+                for(; i < n; ++i)
+                {
+                    if(!(p[i] == p[i]))
+                        return false;
+                    if(Min && p[i] < p[imin])
+                        imin = i;
+                    if(Max && (LastMax ? !(p[i] < p[imax]) : p[imax] < p[i]))
+                        imax = i;
+                }
+                return p[0] == p[0];
+            }
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -19,7 +19,9 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/lower_bound_n.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -36,7 +38,36 @@ namespace ranges
                 ///
                 /// \pre `Rng` is a model of the `Iterable` concept
                 template<typename I, typename V2, typename C = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    // Branchless; see lower_bound_n_fn
+                    RANGES_ASSERT(0 <= d);
+                    if(0 == d)
+                        return begin;
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    while(d > detail::binary_search_prefetch_threshold)
+                    {
+                        auto half = d / 2;
+                        detail::prefetch(begin + half / 2);
+                        detail::prefetch(begin + (half + half / 2));
+                        begin = pred(val, proj(*(begin + half))) ? begin : begin + half;
+                        d -= half;
+                    }
+                    while(d > 1)
+                    {
+                        auto half = d / 2;
+                        begin = pred(val, proj(*(begin + half))) ? begin : begin + half;
+                        d -= half;
+                    }
+                    return pred(val, proj(*begin)) ? begin : begin + 1;
+                }
+
+                /// \overload
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
                 I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
                     P proj_ = P{}) const
                 {
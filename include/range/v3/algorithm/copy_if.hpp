@@ -20,9 +20,11 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/compact_n.hpp>
 
 namespace ranges
 {
@@ -32,15 +34,10 @@ namespace ranges
         /// @{
         struct copy_if_fn
         {
-            template<typename I, typename S, typename O, typename F, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
-                    WeaklyIncrementable<O>() && IndirectInvokablePredicate<F, Project<I, P> >() &&
-                    IndirectlyCopyable<I, O>())>
-            std::pair<I, O>
-            operator()(I begin, S end, O out, F pred_, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename O, typename F, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, F &pred, P &proj, std::false_type)
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj = invokable(proj_);
                 for(; begin != end; ++begin)
                 {
                     auto &&x = *begin;
@@ -52,6 +49,27 @@ namespace ranges
                 }
                 return {begin, out};
             }
+            // Contiguous arithmetic elements are classified 64 at a time, and
+            // copied without branching on the predicate.
+            template<typename I, typename S, typename O, typename F, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, F &pred, P &proj, std::true_type)
+            {
+                auto const n = end - begin;
+                return {begin + n, aux::compact_n(begin, n, out, aux::no_output{}, pred, proj).first};
+            }
+        public:
+            template<typename I, typename S, typename O, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    WeaklyIncrementable<O>() && IndirectInvokablePredicate<F, Project<I, P> >() &&
+                    IndirectlyCopyable<I, O>())>
+            std::pair<I, O>
+            operator()(I begin, S end, O out, F pred_, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return copy_if_fn::impl(std::move(begin), std::move(end), std::move(out), pred,
+                    proj, meta::and_<detail::is_compressible<I, O>, SizedIteratorRange<I, S>>{});
+            }
 
             template<typename Rng, typename O, typename F, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -62,6 +80,37 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
             }
+
+            /// Copies in parallel, preserving the order of the elements. Each
+            /// thread counts the elements to copy in its part of the input, an
+            /// exclusive scan of the counts gives each part's place in the
+            /// output, and the threads then copy their parts there. The
+            /// predicate is called once per element, from several threads.
+            template<typename I, typename S, typename O, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && IndirectInvokablePredicate<F, Project<I, P> >() &&
+                    IndirectlyCopyable<I, O>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, I begin, S end_, O out, F pred_,
+                P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                I end = ranges::next(begin, end_);
+                return {end,
+                    aux::compact_n(policy, begin, end - begin, out, aux::no_output{}, pred, proj).first};
+            }
+
+            template<typename Rng, typename O, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && RandomAccessIterator<O>() &&
+                    IndirectInvokablePredicate<F, Project<I, P> >() && IndirectlyCopyable<I, O>())>
+            std::pair<I, O>
+            operator()(parallel_policy const &policy, Rng &rng, O out, F pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(out), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `copy_if_fn`
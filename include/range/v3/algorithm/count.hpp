@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/reduce_n.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,37 @@ namespace ranges
         /// @{
         struct count_fn
         {
+        private:
+            template<typename V>
+            struct equal_to_value
+            {
+                V const &val;
+                template<typename T>
+                bool operator()(T && t) const
+                {
+                    return (T &&) t == val;
+                }
+            };
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I> impl(I begin, S end, V const &val, P &proj,
+                std::false_type)
+            {
+                iterator_difference_t<I> n = 0;
+                for(; begin != end; ++begin)
+                    if(proj(*begin) == val)
+                        ++n;
+                return n;
+            }
+            // Contiguous arithmetic elements are counted in lanes, without
+            // branching, which the compiler vectorizes.
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I> impl(I begin, S end, V const &val, P &proj,
+                std::true_type)
+            {
+                equal_to_value<V> pred{val};
+                return aux::count_if_n(begin, end - begin, pred, proj);
+            }
+        public:
             template<typename I, typename S, typename V, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
@@ -38,11 +71,8 @@ namespace ranges
             operator()(I begin, S end, V const & val, P proj_ = P{}) const
             {
                 auto &&proj = invokable(proj_);
-                iterator_difference_t<I> n = 0;
-                for(; begin != end; ++begin)
-                    if(proj(*begin) == val)
-                        ++n;
-                return n;
+                return count_fn::impl(std::move(begin), std::move(end), val, proj,
+                    meta::and_<detail::is_contiguous_arithmetic<I>, SizedIteratorRange<I, S>>{});
             }
 
             template<typename Rng, typename V, typename P = ident,
@@ -54,6 +84,40 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), val, std::move(proj));
             }
+
+            /// Counts in parallel: each thread counts the elements of its
+            /// chunk, and the counts are summed.
+            template<typename I, typename S, typename V, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokableRelation<equal_to, Project<I, P>, V const *>>())>
+            iterator_difference_t<I>
+            operator()(parallel_policy const &policy, I begin, S end, V const & val,
+                P proj_ = P{}) const
+            {
+                auto &&proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, end) - begin;
+                return detail::parallel_reduce(policy, n, [&](D lo, D hi)
+                {
+                    return count_fn::impl(begin + lo, begin + hi, val, proj,
+                        detail::is_contiguous_arithmetic<I>{});
+                },
+                [](D a, D b)
+                {
+                    return a + b;
+                });
+            }
+
+            template<typename Rng, typename V, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                    IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
+            iterator_difference_t<I>
+            operator()(parallel_policy const &policy, Rng &&rng, V const & val,
+                P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), val, std::move(proj));
+            }
         };
 
         /// \sa `count_fn`
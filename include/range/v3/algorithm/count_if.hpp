@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/reduce_n.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,24 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            template<typename I, typename S, typename R, typename P>
+            static iterator_difference_t<I> impl(I begin, S end, R &pred, P &proj, std::false_type)
+            {
+                iterator_difference_t<I> n = 0;
+                for(; begin != end; ++begin)
+                    if(pred(proj(*begin)))
+                        ++n;
+                return n;
+            }
+            // Contiguous arithmetic elements are counted in lanes, without
+            // branching, which the compiler vectorizes.
+            template<typename I, typename S, typename R, typename P>
+            static iterator_difference_t<I> impl(I begin, S end, R &pred, P &proj, std::true_type)
+            {
+                return aux::count_if_n(begin, end - begin, pred, proj);
+            }
+        public:
             template<typename I, typename S, typename R, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokablePredicate<R, Project<I, P> >())>
@@ -39,11 +59,8 @@ namespace ranges
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj = invokable(proj_);
-                iterator_difference_t<I> n = 0;
-                for(; begin != end; ++begin)
-                    if(pred(proj(*begin)))
-                        ++n;
-                return n;
+                return count_if_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    meta::and_<detail::is_contiguous_arithmetic<I>, SizedIteratorRange<I, S>>{});
             }
 
             template<typename Rng, typename R, typename P = ident,
@@ -54,6 +71,39 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Counts in parallel: each thread counts the elements of its
+            /// chunk, and the counts are summed.
+            template<typename I, typename S, typename R, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokablePredicate<R, Project<I, P> >>())>
+            iterator_difference_t<I>
+            operator()(parallel_policy const &policy, I begin, S end, R pred_, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, end) - begin;
+                return detail::parallel_reduce(policy, n, [&](D lo, D hi)
+                {
+                    return count_if_fn::impl(begin + lo, begin + hi, pred, proj,
+                        detail::is_contiguous_arithmetic<I>{});
+                },
+                [](D a, D b)
+                {
+                    return a + b;
+                });
+            }
+
+            template<typename Rng, typename R, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                    IndirectInvokablePredicate<R, Project<I, P> >())>
+            iterator_difference_t<I>
+            operator()(parallel_policy const &policy, Rng &&rng, R pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `count_if_fn`
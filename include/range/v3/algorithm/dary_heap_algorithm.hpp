@@ -0,0 +1,380 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_DARY_HEAP_ALGORITHM_HPP
+#define RANGES_V3_ALGORITHM_DARY_HEAP_ALGORITHM_HPP
+
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A d-ary heap stores the children of the node at index i at indices
+            // [Arity*i + 1, Arity*i + Arity], and its parent at (i - 1) / Arity. With
+            // Arity == 4 or 8, all the children of a node usually share a cache line and
+            // the heap is half or a third as deep as a binary heap, so large heaps take
+            // far fewer cache misses per operation. A d-ary heap with Arity == 2 has the
+            // same layout as the heaps built by make_heap.
+            template<std::size_t Arity>
+            struct dary_heap_n
+            {
+                static_assert(Arity >= 2, "A heap must have an arity of at least 2");
+
+                template<typename I>
+                static iterator_difference_t<I> parent(iterator_difference_t<I> i)
+                {
+                    return (i - 1) / static_cast<iterator_difference_t<I>>(Arity);
+                }
+
+                template<typename I, typename C, typename P>
+                static I is_heap_until(I begin, iterator_difference_t<I> n, C &pred, P &proj)
+                {
+                    RANGES_ASSERT(0 <= n);
+                    for(iterator_difference_t<I> c = 1; c < n; ++c)
+                        if(pred(proj(*(begin + parent<I>(c))), proj(*(begin + c))))
+                            return begin + c;
+                    return begin + n;
+                }
+
+                // Returns the largest of the children [first, first + Arity) of
+                // a node, stopping at len.
+                template<typename I, typename C, typename P>
+                static iterator_difference_t<I> max_child(I begin, iterator_difference_t<I> first,
+                    iterator_difference_t<I> len, C &pred, P &proj)
+                {
+                    iterator_difference_t<I> last = first + static_cast<iterator_difference_t<I>>(Arity);
+                    if(len < last)
+                        last = len;
+                    I m = begin + first, i = m;
+                    for(I e = begin + last; ++i != e;)
+                        m = pred(proj(*m), proj(*i)) ? i : m;
+                    return m - begin;
+                }
+
+                // Moves the element at begin + (len - 1) up to its place.
+                template<typename I, typename C, typename P>
+                static void sift_up(I begin, iterator_difference_t<I> len, C &pred, P &proj)
+                {
+                    if(len < 2)
+                        return;
+                    iterator_difference_t<I> hole = len - 1, p = parent<I>(hole);
+                    if(!pred(proj(*(begin + p)), proj(*(begin + hole))))
+                        return;
+                    iterator_value_t<I> v = iter_move(begin + hole);
+                    do
+                    {
+                        *(begin + hole) = iter_move(begin + p);
+                        hole = p;
+                        if(hole == 0)
+                            break;
+                        p = parent<I>(hole);
+                    } while(pred(proj(*(begin + p)), proj(v)));
+                    *(begin + hole) = std::move(v);
+                }
+
+                // Moves the element at begin + start down to its place.
+                template<typename I, typename C, typename P>
+                static void sift_down(I begin, iterator_difference_t<I> len,
+                    iterator_difference_t<I> start, C &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    D child = static_cast<D>(Arity) * start + 1;
+                    if(len <= child)
+                        return;
+                    child = max_child(begin, child, len, pred, proj);
+                    if(!pred(proj(*(begin + start)), proj(*(begin + child))))
+                        return;
+                    iterator_value_t<I> top = iter_move(begin + start);
+                    do
+                    {
+                        *(begin + start) = iter_move(begin + child);
+                        start = child;
+                        child = static_cast<D>(Arity) * start + 1;
+                        if(len <= child)
+                            break;
+                        child = max_child(begin, child, len, pred, proj);
+                    } while(pred(proj(top), proj(*(begin + child))));
+                    *(begin + start) = std::move(top);
+                }
+
+                template<typename I, typename C, typename P>
+                static void make(I begin, iterator_difference_t<I> len, C &pred, P &proj)
+                {
+                    if(len > 1)
+                        // start from the last parent, there is no need to consider leaves
+                        for(auto start = parent<I>(len - 1); start >= 0; --start)
+                            sift_down(begin, len, start, pred, proj);
+                }
+
+                template<typename I, typename C, typename P>
+                static void pop(I begin, iterator_difference_t<I> len, C &pred, P &proj)
+                {
+                    if(len > 1)
+                    {
+                        ranges::iter_swap(begin, begin + (len - 1));
+                        sift_down(begin, len - 1, 0, pred, proj);
+                    }
+                }
+
+                // Floyd's bottom-up pop: walk the hole left by the root all the
+                // way down to a leaf along the path of largest children, without
+                // comparing against the element being re-inserted, then sift the
+                // last element up from there. Since the last element nearly
+                // always belongs near the bottom, this saves about one compare
+                // per level over pop, which pays off when compares are costly.
+                template<typename I, typename C, typename P>
+                static void pop_bottom_up(I begin, iterator_difference_t<I> len, C &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    if(len < 2)
+                        return;
+                    D const last = len - 1;
+                    iterator_value_t<I> top = iter_move(begin);
+                    D hole = 0;
+                    for(D child = 1; child < last; child = static_cast<D>(Arity) * hole + 1)
+                    {
+                        child = max_child(begin, child, last, pred, proj);
+                        *(begin + hole) = iter_move(begin + child);
+                        hole = child;
+                    }
+                    if(hole != last)
+                    {
+                        *(begin + hole) = iter_move(begin + last);
+                        sift_up(begin, hole + 1, pred, proj);
+                    }
+                    *(begin + last) = std::move(top);
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+        template<std::size_t Arity>
+        struct is_dary_heap_until_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && IteratorRange<I, S>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return detail::dary_heap_n<Arity>::is_heap_until(begin, distance(begin, end),
+                    pred, proj);
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && Iterable<Rng &>())>
+            I operator()(Rng &rng, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return detail::dary_heap_n<Arity>::is_heap_until(begin(rng), distance(rng),
+                    pred, proj);
+            }
+        };
+
+        template<std::size_t Arity>
+        struct is_dary_heap_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && IteratorRange<I, S>())>
+            bool operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto n = distance(begin, end);
+                return detail::dary_heap_n<Arity>::is_heap_until(begin, n, pred, proj) ==
+                    begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && Iterable<Rng>())>
+            bool operator()(Rng &&rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        template<std::size_t Arity>
+        struct push_dary_heap_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto n = distance(begin, end);
+                detail::dary_heap_n<Arity>::sift_up(begin, n, pred, proj);
+                return begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        template<std::size_t Arity>
+        struct pop_dary_heap_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto n = distance(begin, end);
+                detail::dary_heap_n<Arity>::pop(begin, n, pred, proj);
+                return begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        /// Like `pop_dary_heap_fn`, but uses Floyd's bottom-up strategy, which
+        /// does fewer comparisons and more moves. Prefer it when comparisons
+        /// are expensive.
+        template<std::size_t Arity>
+        struct pop_dary_heap_bottom_up_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto n = distance(begin, end);
+                detail::dary_heap_n<Arity>::pop_bottom_up(begin, n, pred, proj);
+                return begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        template<std::size_t Arity>
+        struct make_dary_heap_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto n = distance(begin, end);
+                detail::dary_heap_n<Arity>::make(begin, n, pred, proj);
+                return begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        template<std::size_t Arity>
+        struct sort_dary_heap_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
+            I operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                iterator_difference_t<I> const n = distance(begin, end);
+                for(auto i = n; i > 1; --i)
+                    detail::dary_heap_n<Arity>::pop(begin, i, pred, proj);
+                return begin + n;
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+        };
+
+        // C++11 has no variable templates, so the d-ary heap algorithms are
+        // exposed as function templates taking the arity explicitly, as in
+        // `make_dary_heap<4>(rng)`, which forward to the function objects above.
+#define RANGES_DEFINE_DARY_HEAP_ALGORITHM(NAME)                                  \
+        template<std::size_t Arity, typename...Args>                             \
+        auto NAME(Args &&...args)                                                \
+        RANGES_DECLTYPE_AUTO_RETURN                                              \
+        (                                                                        \
+            static_const<NAME ## _fn<Arity>>::value(std::forward<Args>(args)...) \
+        )                                                                        \
+        /**/
+
+        /// \sa `is_dary_heap_until_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(is_dary_heap_until)
+        /// \sa `is_dary_heap_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(is_dary_heap)
+        /// \sa `push_dary_heap_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(push_dary_heap)
+        /// \sa `pop_dary_heap_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(pop_dary_heap)
+        /// \sa `pop_dary_heap_bottom_up_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(pop_dary_heap_bottom_up)
+        /// \sa `make_dary_heap_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(make_dary_heap)
+        /// \sa `sort_dary_heap_fn`
+        RANGES_DEFINE_DARY_HEAP_ALGORITHM(sort_dary_heap)
+
+#undef RANGES_DEFINE_DARY_HEAP_ALGORITHM
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -19,10 +19,12 @@
 #include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/mismatch.hpp>
 
 namespace ranges
 {
@@ -114,6 +116,72 @@ namespace ranges
                 return this->nocheck(begin(rng0), end(rng0), begin(rng1), end(rng1),
                     std::move(pred_), std::move(proj0_), std::move(proj1_));
             }
+
+            /// Compares in parallel, with `mismatch`; the threads stop as soon
+            /// as one of them finds elements that differ.
+            // The constraints are checked in order, so that those on sentinels
+            // are not tried with arguments that are not iterators.
+            template<typename I0, typename S0, typename I1,
+                typename C = equal_to, typename P0 = ident, typename P1 = ident,
+                CONCEPT_REQUIRES_(meta::and_<
+                    RandomAccessIterator<I0>, RandomAccessIterator<I1>,
+                    IteratorRange<I0, S0>,
+                    WeaklyComparable<I0, I1, C, P0, P1>
+                >())>
+            bool operator()(parallel_policy const &policy, I0 begin0, S0 end0, I1 begin1,
+                C pred_ = C{}, P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+            {
+                I0 const end = ranges::next(begin0, end0);
+                return end == mismatch(policy, std::move(begin0), end, std::move(begin1),
+                    std::move(pred_), std::move(proj0_), std::move(proj1_)).first;
+            }
+
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C = equal_to, typename P0 = ident, typename P1 = ident,
+                CONCEPT_REQUIRES_(meta::and_<
+                    RandomAccessIterator<I0>, RandomAccessIterator<I1>,
+                    IteratorRange<I0, S0>, IteratorRange<I1, S1>,
+                    Comparable<I0, I1, C, P0, P1>
+                >())>
+            bool operator()(parallel_policy const &policy, I0 begin0, S0 end0, I1 begin1,
+                S1 end1, C pred_ = C{}, P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+            {
+                I0 const end = ranges::next(begin0, end0);
+                if(end - begin0 != ranges::next(begin1, end1) - begin1)
+                    return false;
+                return (*this)(policy, std::move(begin0), end, std::move(begin1),
+                    std::move(pred_), std::move(proj0_), std::move(proj1_));
+            }
+
+            template<typename Rng0, typename I1Ref,
+                typename C = equal_to, typename P0 = ident, typename P1 = ident,
+                typename I0 = range_iterator_t<Rng0>,
+                typename I1 = uncvref_t<I1Ref>,
+                CONCEPT_REQUIRES_(meta::and_<
+                    RandomAccessIterable<Rng0>, RandomAccessIterator<I1>,
+                    WeaklyComparable<I0, I1, C, P0, P1>
+                >())>
+            bool operator()(parallel_policy const &policy, Rng0 && rng0, I1Ref && begin1,
+                C pred_ = C{}, P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+            {
+                return (*this)(policy, begin(rng0), end(rng0), (I1Ref &&) begin1,
+                    std::move(pred_), std::move(proj0_), std::move(proj1_));
+            }
+
+            template<typename Rng0, typename Rng1,
+                typename C = equal_to, typename P0 = ident, typename P1 = ident,
+                typename I0 = range_iterator_t<Rng0>,
+                typename I1 = range_iterator_t<Rng1>,
+                CONCEPT_REQUIRES_(meta::and_<
+                    RandomAccessIterable<Rng0>, RandomAccessIterable<Rng1>,
+                    Comparable<I0, I1, C, P0, P1>
+                >())>
+            bool operator()(parallel_policy const &policy, Rng0 && rng0, Rng1 && rng1,
+                C pred_ = C{}, P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
+            {
+                return (*this)(policy, begin(rng0), end(rng0), begin(rng1), end(rng1),
+                    std::move(pred_), std::move(proj0_), std::move(proj1_));
+            }
         };
 
         /// \sa `equal_fn`
@@ -17,6 +17,8 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -44,6 +46,35 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), val);
             }
+
+            /// Fills in parallel, each thread its own chunk. Linux places a
+            /// page on the NUMA node of the thread that first writes it. So
+            /// with a `parallel_policy::pinned()` policy, filling a new buffer
+            /// this way puts each chunk on the node that the parallel
+            /// algorithms, run later with the same policy over the same number
+            /// of elements, process it on.
+            template<typename O, typename S, typename V,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<O>, IteratorRange<O, S>,
+                    OutputIterator<O, V>>())>
+            O operator()(parallel_policy const &policy, O begin, S end, V const & val) const
+            {
+                using D = iterator_difference_t<O>;
+                D const n = ranges::next(begin, end) - begin;
+                detail::parallel_for_chunks(policy, n, [&](D lo, D hi)
+                {
+                    for(O b = begin + lo, e = begin + hi; b != e; ++b)
+                        *b = val;
+                });
+                return begin + n;
+            }
+
+            template<typename Rng, typename V,
+                typename O = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && OutputIterable<Rng &, V>())>
+            O operator()(parallel_policy const &policy, Rng & rng, V const & val) const
+            {
+                return (*this)(policy, begin(rng), end(rng), val);
+            }
         };
 
         /// \sa `fill_fn`
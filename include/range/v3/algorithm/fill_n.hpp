@@ -19,6 +19,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -41,6 +42,23 @@ namespace ranges
                     *b = val;
                 return recounted(begin, b, norig);
             }
+
+            /// Fills in parallel, each thread its own chunk; see the parallel
+            /// `fill`.
+            template<typename O, typename V,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<O>, OutputIterator<O, V>>())>
+            O operator()(parallel_policy const &policy, O begin, iterator_difference_t<O> n,
+                V const & val) const
+            {
+                RANGES_ASSERT(n >= 0);
+                using D = iterator_difference_t<O>;
+                detail::parallel_for_chunks(policy, n, [&](D lo, D hi)
+                {
+                    for(O b = begin + lo, e = begin + hi; b != e; ++b)
+                        *b = val;
+                });
+                return begin + n;
+            }
         };
 
         /// \sa `fill_n_fn`
@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -63,6 +64,40 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Searches in parallel, for the first element that satisfies the
+            /// predicate. The threads take turns at blocks of elements from the
+            /// front, and once a match is found, skip the blocks past it. The
+            /// predicate may be called from several threads, and for elements
+            /// after the one returned.
+            template<typename I, typename S, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokablePredicate<F, Project<I, P> >>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, F pred_,
+                P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, end_) - begin;
+                return begin + detail::parallel_find_first(policy, n, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        if(pred(proj(*(begin + lo))))
+                            break;
+                    return lo;
+                });
+            }
+
+            /// \overload
+            template<typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() &&
+                    IndirectInvokablePredicate<F, Project<I, P> >())>
+            I operator()(parallel_policy const &policy, Rng &rng, F pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `find_if_fn`
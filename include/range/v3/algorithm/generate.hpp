@@ -18,6 +18,8 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -48,6 +50,42 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(fun));
             }
+
+            /// Generates in parallel, each thread the elements of its own
+            /// chunk, so that a new buffer is first touched as by the parallel
+            /// `fill`, and with a pinned policy placed as it places it. Unlike
+            /// the sequential `generate`, \c fun is passed the index of the
+            /// element to generate, and the element at index \c i is set to
+            /// `fun(i)`, so the result does not depend on how the range is
+            /// split or in what order the chunks run, as long as `fun(i)`
+            /// depends only on \c i. Each chunk calls its own copy of \c fun,
+            /// concurrently with the others. The returned function object is
+            /// \c fun as it was passed in.
+            template<typename O, typename S, typename F,
+                typename D = iterator_difference_t<O>,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<O>, IteratorRange<O, S>,
+                    Function<F, D>, OutputIterator<O, concepts::Function::result_t<F, D>>>())>
+            std::pair<O, F> operator()(parallel_policy const &policy, O begin, S end, F fun) const
+            {
+                D const n = ranges::next(begin, end) - begin;
+                detail::parallel_for_chunks(policy, n, [&](D lo, D hi)
+                {
+                    F f = fun;
+                    for(; lo != hi; ++lo)
+                        *(begin + lo) = f(lo);
+                });
+                return {begin + n, std::move(fun)};
+            }
+
+            template<typename Rng, typename F,
+                typename O = range_iterator_t<Rng>,
+                typename D = iterator_difference_t<O>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Function<F, D>() &&
+                    OutputIterable<Rng &, concepts::Function::result_t<F, D>>())>
+            std::pair<O, F> operator()(parallel_policy const &policy, Rng & rng, F fun) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(fun));
+            }
         };
 
         /// \sa `generate_fn`
@@ -20,6 +20,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -43,6 +44,25 @@ namespace ranges
                     *b = fun();
                 return {recounted(begin, b, norig), fun};
             }
+
+            /// Generates in parallel, setting the element at index \c i to
+            /// `fun(i)`; see the parallel `generate`.
+            template<typename O, typename F,
+                typename D = iterator_difference_t<O>,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<O>, Function<F, D>,
+                    OutputIterator<O, concepts::Function::result_t<F, D>>>())>
+            std::pair<O, F> operator()(parallel_policy const &policy, O begin,
+                iterator_difference_t<O> n, F fun) const
+            {
+                RANGES_ASSERT(n >= 0);
+                detail::parallel_for_chunks(policy, n, [&](D lo, D hi)
+                {
+                    F f = fun;
+                    for(; lo != hi; ++lo)
+                        *(begin + lo) = f(lo);
+                });
+                return {begin + n, std::move(fun)};
+            }
         };
 
         /// \sa `generate_n_fn`
@@ -0,0 +1,92 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_LOWER_BOUND_MANY_HPP
+#define RANGES_V3_ALGORITHM_LOWER_BOUND_MANY_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/bound_many_n.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Writes `lower_bound(haystack, q, pred, proj)` to `out` for each query
+        /// `q`, in order. Runs of sorted queries are searched for by galloping
+        /// forward from the previous answer, and unsorted queries by several
+        /// interleaved binary searches whose cache misses overlap.
+        struct lower_bound_many_fn
+        {
+            template<typename I, typename S, typename QI, typename QS, typename O,
+                typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(BinarySearchableMany<I, QI, C, P>() && IteratorRange<I, S>() &&
+                    IteratorRange<QI, QS>() && WeaklyIncrementable<O>() && Writable<O, I>())>
+            std::pair<QI, O>
+            operator()(I begin, S end_, QI qbegin, QS qend, O out, C pred_ = C{},
+                P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                I end = next(begin, end_);
+                auto before = [&](iterator_reference_t<I> x, iterator_value_t<QI> const &q)
+                {
+                    return pred(proj(x), q);
+                };
+                auto sink = [&](I hit, iterator_value_t<QI> const &)
+                {
+                    *out = hit;
+                    ++out;
+                };
+                qbegin = aux::bound_many(begin, end, std::move(qbegin), std::move(qend), pred,
+                    before, sink);
+                return {qbegin, out};
+            }
+
+            template<typename Rng, typename Queries, typename O, typename C = ordered_less,
+                typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                typename QI = range_iterator_t<Queries>,
+                CONCEPT_REQUIRES_(BinarySearchableMany<I, QI, C, P>() && Iterable<Rng &>() &&
+                    Iterable<Queries &>() && WeaklyIncrementable<O>() && Writable<O, I>())>
+            std::pair<QI, O>
+            operator()(Rng &haystack, Queries &&queries, O out, C pred = C{}, P proj = P{}) const
+            {
+                static_assert(!is_infinite<Rng>::value, "Trying to binary search an infinite range");
+                return (*this)(begin(haystack), end(haystack), begin(queries), end(queries),
+                    std::move(out), std::move(pred), std::move(proj));
+            }
+        };
+
+        /// \sa `lower_bound_many_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& lower_bound_many = static_const<with_braced_init_args<lower_bound_many_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -14,6 +14,7 @@
 #define RANGES_V3_ALGORITHM_MIN_ELEMENT_HPP
 
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/reduce_n.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,29 @@ namespace ranges
         /// @{
         struct min_element_fn
         {
+        private:
+            template<typename I, typename S, typename C, typename P>
+            static I impl(I begin, S end, C &pred, P &proj, std::false_type)
+            {
+                if(begin != end)
+                    for(auto tmp = next(begin); tmp != end; ++tmp)
+                        if(pred(proj(*tmp), proj(*begin)))
+                            begin = tmp;
+                return begin;
+            }
+            // Contiguous arithmetic elements, compared with <, are reduced in
+            // lanes that the compiler vectorizes.
+            template<typename I, typename S, typename C, typename P>
+            static I impl(I begin, S end, C &pred, P &proj, std::true_type)
+            {
+                auto const n = end - begin;
+                std::ptrdiff_t imin = 0, imax = 0;
+                if(0 != n && aux::extrema_n<true, false, false>(&*begin, n, imin, imax))
+                    return begin + imin;
+                return min_element_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    std::false_type{});
+            }
+        public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokableRelation<C, Project<I, P>>())>
@@ -38,11 +63,8 @@ namespace ranges
             {
                 auto && pred = invokable(pred_);
                 auto && proj = invokable(proj_);
-                if(begin != end)
-                    for(auto tmp = next(begin); tmp != end; ++tmp)
-                        if(pred(proj(*tmp), proj(*begin)))
-                            begin = tmp;
-                return begin;
+                return min_element_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    meta::and_<detail::is_plain_extremum<I, C, P>, SizedIteratorRange<I, S>>{});
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
@@ -53,6 +75,40 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Searches in parallel: each thread finds the first least element of
+            /// its chunk, and the first least of those is returned.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokableRelation<C, Project<I, P>>>())>
+            I operator()(parallel_policy const &policy, I begin, S end, C pred_ = C{},
+                P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, end) - begin;
+                if(0 == n)
+                    return begin;
+                return begin + detail::parallel_reduce(policy, n, [&](D lo, D hi)
+                {
+                    return min_element_fn::impl(begin + lo, begin + hi, pred, proj,
+                        detail::is_plain_extremum<I, C, P>{}) - begin;
+                },
+                [&](D i, D j)
+                {
+                    return pred(proj(*(begin + j)), proj(*(begin + i))) ? j : i;
+                });
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() &&
+                    IndirectInvokableRelation<C, Project<I, P>>())>
+            I operator()(parallel_policy const &policy, Rng &rng, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `min_element_fn`
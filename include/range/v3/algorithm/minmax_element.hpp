@@ -17,6 +17,7 @@
 #define RANGES_V3_ALGORITHM_MINMAX_ELEMENT_HPP
 
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -25,6 +26,7 @@
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/reduce_n.hpp>
 
 namespace ranges
 {
@@ -34,13 +36,10 @@ namespace ranges
         /// @{
         struct minmax_element_fn
         {
-            template<typename I, typename S, typename C = ordered_less, typename P = ident,
-                CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
-                    IndirectInvokableRelation<C, Project<I, P>>())>
-            std::pair<I, I> operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename C, typename P>
+            static std::pair<I, I> impl(I begin, S end, C &pred, P &proj, std::false_type)
             {
-                auto && pred = invokable(pred_);
-                auto && proj = invokable(proj_);
                 std::pair<I, I> result{begin, begin};
                 if(begin == end || ++begin == end)
                     return result;
@@ -79,6 +78,29 @@ namespace ranges
                 }
                 return result;
             }
+            // Contiguous arithmetic elements, compared with <, are reduced in
+            // lanes that the compiler vectorizes, both extremes in one pass.
+            template<typename I, typename S, typename C, typename P>
+            static std::pair<I, I> impl(I begin, S end, C &pred, P &proj, std::true_type)
+            {
+                auto const n = end - begin;
+                std::ptrdiff_t imin = 0, imax = 0;
+                if(0 != n && aux::extrema_n<true, true, true>(&*begin, n, imin, imax))
+                    return {begin + imin, begin + imax};
+                return minmax_element_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    std::false_type{});
+            }
+        public:
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
+                    IndirectInvokableRelation<C, Project<I, P>>())>
+            std::pair<I, I> operator()(I begin, S end, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                return minmax_element_fn::impl(std::move(begin), std::move(end), pred, proj,
+                    meta::and_<detail::is_plain_extremum<I, C, P>, SizedIteratorRange<I, S>>{});
+            }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -88,6 +110,48 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Searches in parallel: each thread finds the first least and the
+            /// last greatest elements of its chunk, and the first least and the
+            /// last greatest of those are returned.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I>, IteratorRange<I, S>,
+                    IndirectInvokableRelation<C, Project<I, P>>>())>
+            std::pair<I, I> operator()(parallel_policy const &policy, I begin, S end,
+                C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, end) - begin;
+                if(0 == n)
+                    return {begin, begin};
+                auto const result = detail::parallel_reduce(policy, n, [&](D lo, D hi)
+                {
+                    auto const r = minmax_element_fn::impl(begin + lo, begin + hi, pred, proj,
+                        detail::is_plain_extremum<I, C, P>{});
+                    return std::make_pair(D(r.first - begin), D(r.second - begin));
+                },
+                [&](std::pair<D, D> result, std::pair<D, D> r)
+                {
+                    if(pred(proj(*(begin + r.first)), proj(*(begin + result.first))))
+                        result.first = r.first;
+                    if(!pred(proj(*(begin + r.second)), proj(*(begin + result.second))))
+                        result.second = r.second;
+                    return result;
+                });
+                return {begin + result.first, begin + result.second};
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() &&
+                    IndirectInvokableRelation<C, Project<I, P>>())>
+            std::pair<I, I> operator()(parallel_policy const &policy, Rng &rng, C pred = C{},
+                P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `minmax_element_fn`
@@ -51,6 +51,25 @@ namespace ranges
         /// @{
         struct mismatch_fn
         {
+        private:
+            template<typename I1, typename I2, typename C, typename P1, typename P2>
+            static std::pair<I1, I2> parallel_n(parallel_policy const &policy, I1 begin1,
+                I2 begin2, iterator_difference_t<I1> n, C &pred_, P1 &proj1_, P2 &proj2_)
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj1 = invokable(proj1_);
+                auto &&proj2 = invokable(proj2_);
+                using D = iterator_difference_t<I1>;
+                D const i = detail::parallel_find_first(policy, n, [&](D lo, D hi)
+                {
+                    for(; lo != hi; ++lo)
+                        if(!pred(proj1(*(begin1 + lo)), proj2(*(begin2 + lo))))
+                            break;
+                    return lo;
+                });
+                return {begin1 + i, begin2 + i};
+            }
+        public:
             template<typename I1, typename S1, typename I2, typename C = equal_to,
                 typename P1 = ident, typename P2 = ident,
                 CONCEPT_REQUIRES_(Mismatchable1<I1, I2, C, P1, P2>() && IteratorRange<I1, S1>())>
@@ -109,6 +128,65 @@ namespace ranges
                 return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(pred),
                     std::move(proj1), std::move(proj2));
             }
+
+            /// Compares in parallel. The threads take turns at blocks of
+            /// elements from the front, and once a mismatch is found, skip the
+            /// blocks past it; the first mismatch is returned.
+            template<typename I1, typename S1, typename I2, typename C = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I1>, RandomAccessIterator<I2>,
+                    Mismatchable1<I1, I2, C, P1, P2>, IteratorRange<I1, S1>>())>
+            std::pair<I1, I2>
+            operator()(parallel_policy const &policy, I1 begin1, S1 end1, I2 begin2,
+                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                auto const n = ranges::next(begin1, end1) - begin1;
+                return mismatch_fn::parallel_n(policy, std::move(begin1), std::move(begin2), n,
+                    pred, proj1, proj2);
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C = equal_to,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<I1>, RandomAccessIterator<I2>,
+                    Mismatchable2<I1, I2, C, P1, P2>, IteratorRange<I1, S1>,
+                    IteratorRange<I2, S2>>())>
+            std::pair<I1, I2>
+            operator()(parallel_policy const &policy, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                auto const n1 = ranges::next(begin1, end1) - begin1;
+                auto const n2 = ranges::next(begin2, end2) - begin2;
+                return mismatch_fn::parallel_n(policy, std::move(begin1), std::move(begin2),
+                    n1 < n2 ? n1 : static_cast<iterator_difference_t<I1>>(n2), pred, proj1, proj2);
+            }
+
+            template<typename Rng1, typename I2Ref, typename C = equal_to, typename P1 = ident,
+                typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = detail::decay_t<I2Ref>, // [*] See below
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng1 &>() && RandomAccessIterator<I2>() &&
+                    Mismatchable1<I1, I2, C, P1, P2>())>
+            std::pair<I1, I2>
+            operator()(parallel_policy const &policy, Rng1 & rng1, I2Ref &&begin2, C pred = C{},
+                P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(policy, begin(rng1), end(rng1), std::forward<I2>(begin2),
+                    std::move(pred), std::move(proj1), std::move(proj2));
+            }
+
+            template<typename Rng1, typename Rng2, typename C = equal_to, typename P1 = ident,
+                typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng1 &>() && RandomAccessIterable<Rng2 &>() &&
+                    Mismatchable2<I1, I2, C, P1, P2>())>
+            std::pair<I1, I2>
+            operator()(parallel_policy const &policy, Rng1 &rng1, Rng2 &rng2, C pred = C{},
+                P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(policy, begin(rng1), end(rng1), begin(rng2), end(rng2),
+                    std::move(pred), std::move(proj1), std::move(proj2));
+            }
         };
 
         /// \sa `mismatch_fn`
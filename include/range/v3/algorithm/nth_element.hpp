@@ -23,7 +23,11 @@
 #ifndef RANGES_V3_ALGORITHM_NTH_ELEMENT_HPP
 #define RANGES_V3_ALGORITHM_NTH_ELEMENT_HPP
 
+#include <cmath>
+#include <cstdint>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -34,6 +38,8 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -97,20 +103,12 @@ namespace ranges
                         ranges::iter_swap(begin, i);
                 }
             }
-        }
-        /// \endcond
 
-        /// \addtogroup group-algorithms
-        /// @{
-        struct nth_element_fn
-        {
-            template<typename I, typename S, typename C = ordered_less, typename P = ident,
-                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sortable<I, C, P>())>
-            I operator()(I begin, I nth, S end_, C pred_ = C{}, P proj_ = P{}) const
+            // The quickselect used for small ranges and as the final stage of
+            // floyd_rivest_select. Selects using median-of-3 pivots.
+            template<typename I, typename C, typename P>
+            void quickselect(I begin, I nth, I end, C &pred, P &proj)
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj = invokable(proj_);
-                I end = ranges::next(nth, end_), end_orig = end;
                 // C is known to be a reference type
                 using difference_type = iterator_difference_t<I>;
                 difference_type const limit = 7;
@@ -118,28 +116,28 @@ namespace ranges
                 {
                 restart:
                     if(nth == end)
-                        return end_orig;
+                        return;
                     difference_type len = end - begin;
                     switch(len)
                     {
                     case 0:
                     case 1:
-                        return end_orig;
+                        return;
                     case 2:
                         if(pred(proj(*--end), proj(*begin)))
                             ranges::iter_swap(begin, end);
-                        return end_orig;
+                        return;
                     case 3:
                         {
                         I m = begin;
                         detail::sort3(begin, ++m, --end, pred, proj);
-                        return end_orig;
+                        return;
                         }
                     }
                     if(len <= limit)
                     {
                         detail::selection_sort(begin, end, pred, proj);
-                        return end_orig;
+                        return;
                     }
                     // len > limit >= 3
                     I m = begin + len/2;
@@ -170,7 +168,7 @@ namespace ranges
                                     while(true)
                                     {
                                         if(i == j)
-                                            return end_orig;  // [begin, end) all equivalent elements
+                                            return;  // [begin, end) all equivalent elements
                                         if(pred(proj(*begin), proj(*i)))
                                         {
                                             ranges::iter_swap(i, j);
@@ -183,7 +181,7 @@ namespace ranges
                                 }
                                 // [begin, i) == *begin and *begin < [j, end) and j == end - 1
                                 if(i == j)
-                                    return end_orig;
+                                    return;
                                 while(true)
                                 {
                                     while(!pred(proj(*begin), proj(*i)))
@@ -199,7 +197,7 @@ namespace ranges
                                 // [begin, i) == *begin and *begin < [i, end)
                                 // The begin part is sorted,
                                 if(nth < i)
-                                    return end_orig;
+                                    return;
                                 // nth_element the second part
                                 // nth_element<C>(i, nth, end, pred);
                                 begin = i;
@@ -246,7 +244,7 @@ namespace ranges
                     }
                     // [begin, i) < *i and *i <= [i+1, end)
                     if(nth == i)
-                        return end_orig;
+                        return;
                     if(n_swaps == 0)
                     {
                         // We were given a perfectly partitioned sequence.  Coincidence?
@@ -262,7 +260,7 @@ namespace ranges
                                 m = j;
                             }
                             // [begin, i) sorted
-                            return end_orig;
+                            return;
                         }
                         else
                         {
@@ -276,7 +274,7 @@ namespace ranges
                                 m = j;
                             }
                             // [i, end) sorted
-                            return end_orig;
+                            return;
                         }
                     }
             not_sorted:
@@ -292,7 +290,133 @@ namespace ranges
                         begin = ++i;
                     }
                 }
-                return end_orig;
+            }
+
+            // Partition [begin, end) around *begin. Elements equivalent to the
+            // pivot are allowed on either side, so runs of equal keys split
+            // evenly. Returns the final position of the pivot.
+            template<typename I, typename C, typename P>
+            I partition_around_first(I begin, I end, C &pred, P &proj)
+            {
+                I i = begin, j = end;
+                while(true)
+                {
+                    while(++i != end && pred(proj(*i), proj(*begin)))
+                        ;
+                    while(pred(proj(*begin), proj(*--j)))
+                        ;
+                    if(!(i < j))
+                        break;
+                    ranges::iter_swap(i, j);
+                }
+                ranges::iter_swap(begin, j);
+                return j;
+            }
+
+            // Median-of-medians selection. Guaranteed O(N), but with a large
+            // constant; used only when a floyd_rivest_select pass makes too
+            // little progress.
+            template<typename I, typename C, typename P>
+            void linear_select(I begin, I nth, I end, C &pred, P &proj)
+            {
+                using difference_type = iterator_difference_t<I>;
+                difference_type const limit = 7;
+                while(end - begin > limit)
+                {
+                    // Move the median of each group of 5 to the front.
+                    I store = begin;
+                    for(I g = begin; end - g >= 5; g += 5)
+                    {
+                        detail::selection_sort(g, g + 5, pred, proj);
+                        ranges::iter_swap(store, g + 2);
+                        ++store;
+                    }
+                    I m = begin + (store - begin) / 2;
+                    detail::linear_select(begin, m, store, pred, proj);
+                    ranges::iter_swap(begin, m);
+                    I p = detail::partition_around_first(begin, end, pred, proj);
+                    if(p == nth)
+                        return;
+                    if(nth < p)
+                        end = p;
+                    else
+                        begin = ++p;
+                }
+                if(begin != end)
+                    detail::selection_sort(begin, end, pred, proj);
+            }
+
+            // Floyd & Rivest, "Algorithm 489: The Algorithm SELECT", CACM 1975.
+            // For large ranges, recursively select nth within a small sample
+            // around the expected position to get a pivot that lands very
+            // close to nth, so that each partition pass discards almost
+            // everything. A pass that keeps more than three quarters of the
+            // range (adversarial input) hands the rest to linear_select, so
+            // the passes shrink geometrically and the worst case is O(N).
+            template<typename I, typename C, typename P>
+            void floyd_rivest_select(I begin, I nth, I end, C &pred, P &proj)
+            {
+                using difference_type = iterator_difference_t<I>;
+                difference_type const limit = 600;
+                while(nth != end && end - begin > limit)
+                {
+                    difference_type const n = end - begin, i = nth - begin;
+                    double const z = std::log(static_cast<double>(n));
+                    double const s = 0.5 * std::exp(2.0 * z / 3.0);
+                    double const sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (2 * i < n ? -1 : 1);
+                    difference_type lo = static_cast<difference_type>(i - i * s / n + sd);
+                    difference_type hi = static_cast<difference_type>(i + (n - i) * s / n + sd) + 1;
+                    lo = (std::max)(difference_type(0), (std::min)(lo, i));
+                    hi = (std::min)(n, (std::max)(hi, i + 1));
+                    detail::floyd_rivest_select(begin + lo, nth, begin + hi, pred, proj);
+                    // *nth is now very close to its final value; partition around it
+                    ranges::iter_swap(begin, nth);
+                    I p = detail::partition_around_first(begin, end, pred, proj);
+                    if(p == nth)
+                        return;
+                    if(nth < p)
+                        end = p;
+                    else
+                        begin = ++p;
+                    if(end - begin > n - n / 4)
+                        return detail::linear_select(begin, nth, end, pred, proj);
+                }
+                detail::quickselect(begin, nth, end, pred, proj);
+            }
+
+            // Select every position in [kbegin, kend) (sorted, unique offsets
+            // from first) within [begin, end), splitting at the median key so
+            // that each partition pass is shared by the keys on either side.
+            template<typename I, typename C, typename P, typename D>
+            void multi_select(I first, I begin, I end, D const *kbegin, D const *kend,
+                C &pred, P &proj)
+            {
+                while(kbegin != kend)
+                {
+                    D const *km = kbegin + (kend - kbegin) / 2;
+                    I nth = first + *km;
+                    detail::floyd_rivest_select(begin, nth, end, pred, proj);
+                    detail::multi_select(first, begin, nth, kbegin, km, pred, proj);
+                    begin = ++nth;
+                    kbegin = ++km;
+                }
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+        struct nth_element_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sortable<I, C, P>())>
+            I operator()(I begin, I nth, S end_, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                I end = ranges::next(nth, end_);
+                detail::floyd_rivest_select(begin, nth, end, pred, proj);
+                return end;
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
@@ -314,6 +438,60 @@ namespace ranges
             constexpr auto&& nth_element = static_const<nth_element_fn>::value;
         }
 
+        /// Partially sorts a range so that every element at one of the given
+        /// offsets is the element that would be there if the range were
+        /// sorted, and the range is partitioned around each of them. The
+        /// partitioning work is shared between the order statistics, which
+        /// makes computing several percentiles at once much cheaper than
+        /// calling `nth_element` once per percentile.
+        struct nth_elements_fn
+        {
+            template<typename I, typename S, typename Ks, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sortable<I, C, P>() &&
+                    InputIterable<Ks>() && Integral<range_value_t<Ks>>())>
+            I operator()(I begin, S end_, Ks &&ks, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                using difference_type = iterator_difference_t<I>;
+                I end = ranges::next(begin, end_);
+                difference_type const len = end - begin;
+                std::vector<difference_type> offsets;
+                // Compared as unsigned, an offset past the range is never
+                // mistaken for a negative one by the cast to difference_type.
+                for(auto &&k : ks)
+                    if(0 <= k && static_cast<std::uintmax_t>(k) < static_cast<std::uintmax_t>(len))
+                        offsets.push_back(static_cast<difference_type>(k));
+                ranges::sort(offsets);
+                offsets.erase(ranges::unique(offsets), offsets.end());
+                detail::multi_select(begin, begin, end, offsets.data(),
+                    offsets.data() + offsets.size(), pred, proj);
+                return end;
+            }
+
+            template<typename Rng, typename Ks, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterable<Rng &>() &&
+                    Sortable<I, C, P>() &&
+                    InputIterable<Ks>() &&
+                    Integral<range_value_t<Ks>>()
+                )>
+            I operator()(Rng &rng, Ks &&ks, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<Ks>(ks), std::move(pred),
+                    std::move(proj));
+            }
+        };
+
+        /// \sa `nth_elements_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& nth_elements = static_const<with_braced_init_args<nth_elements_fn>>::value;
+        }
+
         /// @}
     } // namespace v3
 } // namespace ranges
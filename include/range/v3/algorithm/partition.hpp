@@ -21,6 +21,9 @@
 #ifndef RANGES_V3_ALGORITHM_PARTITION_HPP
 #define RANGES_V3_ALGORITHM_PARTITION_HPP
 
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -97,6 +100,18 @@ namespace ranges
                     ++begin;
                 }
             }
+
+            // The position of the element of the given rank among those of
+            // the intervals ivs, as the index of its interval and its offset
+            template<typename D>
+            static std::pair<std::size_t, D> interval_at(std::vector<std::pair<D, D>> const &ivs,
+                D rank)
+            {
+                std::size_t k = 0;
+                for(; rank >= ivs[k].second - ivs[k].first; ++k)
+                    rank -= ivs[k].second - ivs[k].first;
+                return {k, ivs[k].first + rank};
+            }
         public:
             template<typename I, typename S, typename C, typename P = ident,
                 CONCEPT_REQUIRES_(Partitionable<I, C, P>() && IteratorRange<I, S>())>
@@ -114,6 +129,80 @@ namespace ranges
                 return partition_fn::impl(begin(rng), end(rng), std::move(pred),
                     std::move(proj), iterator_concept<I>());
             }
+
+            /// Partitions in parallel, in place. Each thread partitions a
+            /// contiguous chunk; then the elements that do not satisfy the
+            /// predicate but lie before the partition point are swapped, in
+            /// parallel, with those that do and lie after it. The predicate is
+            /// called once per element, from several threads.
+            template<typename I, typename S, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(Partitionable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, C pred, P proj = P{}) const
+            {
+                using D = iterator_difference_t<I>;
+                using interval = std::pair<D, D>;
+                I end = ranges::next(begin, end_);
+                D const n = end - begin;
+                std::size_t const chunks = detail::parallel_chunks(policy, n);
+                if(chunks <= 1)
+                    return partition_fn::impl(begin, end, std::move(pred), std::move(proj),
+                        iterator_concept<I>());
+                std::vector<D> trues(chunks);
+                detail::parallel_for(policy, chunks, [&](std::size_t k)
+                {
+                    auto const r = detail::static_chunk(n, chunks, k);
+                    trues[k] = partition_fn::impl(begin + r.first, begin + r.second, pred, proj,
+                        iterator_concept<I>()) - (begin + r.first);
+                });
+                D total = 0;
+                for(D t : trues)
+                    total += t;
+                // Each chunk is now its trues followed by its falses. Pair up the
+                // falses before the partition point with the trues after it.
+                std::vector<interval> misplaced_falses, misplaced_trues;
+                D misplaced = 0;
+                for(std::size_t k = 0; k < chunks; ++k)
+                {
+                    auto const r = detail::static_chunk(n, chunks, k);
+                    D const mid = r.first + trues[k];
+                    if(mid < total && mid < r.second)
+                    {
+                        misplaced_falses.emplace_back(mid, (std::min)(r.second, total));
+                        misplaced += misplaced_falses.back().second - mid;
+                    }
+                    if(total < mid)
+                        misplaced_trues.emplace_back((std::max)(r.first, total), mid);
+                }
+                std::size_t const swaps = detail::parallel_chunks(policy, misplaced);
+                detail::parallel_for(policy, swaps, [&](std::size_t q)
+                {
+                    auto const r = detail::static_chunk(misplaced, swaps, q);
+                    if(r.first == r.second)
+                        return;
+                    auto f = partition_fn::interval_at(misplaced_falses, r.first);
+                    auto t = partition_fn::interval_at(misplaced_trues, r.first);
+                    for(D rank = r.first;;)
+                    {
+                        ranges::iter_swap(begin + f.second, begin + t.second);
+                        if(++rank == r.second)
+                            break;
+                        if(++f.second == misplaced_falses[f.first].second)
+                            f.second = misplaced_falses[++f.first].first;
+                        if(++t.second == misplaced_trues[t.first].second)
+                            t.second = misplaced_trues[++t.first].first;
+                    }
+                });
+                return begin + total;
+            }
+
+            template<typename Rng, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Partitionable<I, C, P>() && RandomAccessIterable<Rng &>())>
+            I operator()(parallel_policy const &policy, Rng &rng, C pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `partition_fn`
@@ -25,6 +25,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/compact_n.hpp>
 
 namespace ranges
 {
@@ -44,12 +45,11 @@ namespace ranges
         /// @{
         struct partition_copy_fn
         {
-            template<typename I, typename S, typename O0, typename O1, typename C, typename P = ident,
-                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() && IteratorRange<I, S>())>
-            std::tuple<I, O0, O1> operator()(I begin, S end, O0 o0, O1 o1, C pred_, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename O0, typename O1, typename C, typename P>
+            static std::tuple<I, O0, O1> impl(I begin, S end, O0 o0, O1 o1, C &pred, P &proj,
+                std::false_type)
             {
-                auto && pred = invokable(pred_);
-                auto && proj = invokable(proj_);
                 for(; begin != end; ++begin)
                 {
                     auto &&x = *begin;
@@ -66,6 +66,26 @@ namespace ranges
                 }
                 return std::tuple<I, O0, O1>{begin, o0, o1};
             }
+            template<typename I, typename S, typename O0, typename O1, typename C, typename P>
+            static std::tuple<I, O0, O1> impl(I begin, S end, O0 o0, O1 o1, C &pred, P &proj,
+                std::true_type)
+            {
+                auto const n = end - begin;
+                auto const outs = aux::compact_n(begin, n, o0, o1, pred, proj);
+                return std::tuple<I, O0, O1>{begin + n, outs.first, outs.second};
+            }
+        public:
+            template<typename I, typename S, typename O0, typename O1, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() && IteratorRange<I, S>())>
+            std::tuple<I, O0, O1> operator()(I begin, S end, O0 o0, O1 o1, C pred_, P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                return partition_copy_fn::impl(std::move(begin), std::move(end), std::move(o0),
+                    std::move(o1), pred, proj,
+                    meta::and_<detail::is_compressible<I, O0>, detail::is_compressible<I, O1>,
+                        SizedIteratorRange<I, S>>{});
+            }
 
             template<typename Rng, typename O0, typename O1, typename C, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -75,6 +95,35 @@ namespace ranges
                 return (*this)(begin(rng), end(rng), std::move(o0), std::move(o1), std::move(pred),
                     std::move(proj));
             }
+
+            /// Copies in parallel, preserving the order of the elements in both
+            /// outputs, as the parallel `copy_if` does.
+            template<typename I, typename S, typename O0, typename O1, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<I>() && RandomAccessIterator<O0>() &&
+                    RandomAccessIterator<O1>())>
+            std::tuple<I, O0, O1> operator()(parallel_policy const &policy, I begin, S end_, O0 o0,
+                O1 o1, C pred_, P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                I end = ranges::next(begin, end_);
+                auto const outs = aux::compact_n(policy, begin, end - begin, std::move(o0),
+                    std::move(o1), pred, proj);
+                return std::tuple<I, O0, O1>{end, outs.first, outs.second};
+            }
+
+            template<typename Rng, typename O0, typename O1, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() &&
+                    RandomAccessIterable<Rng &>() && RandomAccessIterator<O0>() &&
+                    RandomAccessIterator<O1>())>
+            std::tuple<I, O0, O1> operator()(parallel_policy const &policy, Rng &rng, O0 o0, O1 o1,
+                C pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(o0), std::move(o1),
+                    std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `partition_copy_fn`
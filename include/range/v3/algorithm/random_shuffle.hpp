@@ -14,6 +14,7 @@
 #define RANGES_V3_ALGORITHM_RANDOM_SHUFFLE_HPP
 
 #include <random>
+#include <cstdint>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -24,6 +25,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
 
 namespace ranges
 {
@@ -71,15 +73,9 @@ namespace ranges
                 auto d = end - begin;
                 if(d > 1)
                 {
-                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
-                    std::default_random_engine gen(detail::random_seed_());
-                    std::uniform_int_distribution<std::ptrdiff_t> uid;
-                    for(--end, --d; begin < end; ++begin, --d)
-                    {
-                        auto i = uid(gen, param_t{0, d});
-                        if(i != 0)
-                            ranges::iter_swap(begin, begin + i);
-                    }
+                    std::uint64_t const seed = detail::random_seed_();
+                    detail::splitmix64 gen{(seed << 32) | detail::random_seed_()};
+                    detail::fisher_yates(begin, d, gen);
                 }
                 return end;
             }
@@ -94,7 +90,8 @@ namespace ranges
                 auto d = end - begin;
                 if(d > 1)
                 {
-                    for(--end, --d; begin < end; ++begin, --d)
+                    I last = ranges::prev(end);
+                    for(--d; begin < last; ++begin, --d)
                     {
                         auto i = rand(d);
                         ranges::iter_swap(begin, begin + i);
@@ -21,7 +21,9 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/compact_n.hpp>
 
 namespace ranges
 {
@@ -39,12 +41,10 @@ namespace ranges
         /// @{
         struct remove_copy_if_fn
         {
-            template<typename I, typename S, typename O, typename C, typename P = ident,
-                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && IteratorRange<I, S>())>
-            std::pair<I, O> operator()(I begin, S end, O out, C pred_, P proj_ = P{}) const
+        private:
+            template<typename I, typename S, typename O, typename C, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, C &pred, P &proj, std::false_type)
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj = invokable(proj_);
                 for(; begin != end; ++begin)
                 {
                     auto &&x = *begin;
@@ -56,6 +56,23 @@ namespace ranges
                 }
                 return {begin, out};
             }
+            template<typename I, typename S, typename O, typename C, typename P>
+            static std::pair<I, O> impl(I begin, S end, O out, C &pred, P &proj, std::true_type)
+            {
+                auto const n = end - begin;
+                return {begin + n, aux::compact_n(begin, n, aux::no_output{}, out, pred, proj).second};
+            }
+        public:
+            template<typename I, typename S, typename O, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && IteratorRange<I, S>())>
+            std::pair<I, O> operator()(I begin, S end, O out, C pred_, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return remove_copy_if_fn::impl(std::move(begin), std::move(end), std::move(out),
+                    pred, proj,
+                    meta::and_<detail::is_compressible<I, O>, SizedIteratorRange<I, S>>{});
+            }
 
             template<typename Rng, typename O, typename C, typename P = ident,
                 typename I = range_iterator_t<Rng>,
@@ -64,6 +81,32 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
             }
+
+            /// Copies in parallel, preserving the order of the elements, as
+            /// the parallel `copy_if` does.
+            template<typename I, typename S, typename O, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<I>() && RandomAccessIterator<O>())>
+            std::pair<I, O> operator()(parallel_policy const &policy, I begin, S end_, O out,
+                C pred_, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                I end = ranges::next(begin, end_);
+                return {end,
+                    aux::compact_n(policy, begin, end - begin, aux::no_output{}, out, pred, proj).second};
+            }
+
+            template<typename Rng, typename O, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && RandomAccessIterable<Rng &>() &&
+                    RandomAccessIterator<O>())>
+            std::pair<I, O> operator()(parallel_policy const &policy, Rng &rng, O out, C pred,
+                P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(out), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `remove_copy_if_fn`
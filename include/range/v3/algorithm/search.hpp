@@ -33,6 +33,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/searchers.hpp>
 
 namespace ranges
 {
@@ -157,6 +158,66 @@ namespace ranges
                     }
                 }
             }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C, typename P1,
+                typename P2>
+            static I1 dispatch(I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1,
+                P2 &proj2, std::false_type)
+            {
+                if(SizedIteratorRange<I1, S1>() && SizedIteratorRange<I2, S2>())
+                    return search_fn::sized_impl(std::move(begin1), std::move(end1), distance(begin1, end1),
+                        std::move(begin2), std::move(end2), distance(begin2, end2), pred, proj1, proj2);
+                else
+                    return search_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), pred, proj1, proj2);
+            }
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            static range_iterator_t<Rng1> dispatch(Rng1 &rng1, Rng2 &rng2, C &pred, P1 &proj1,
+                P2 &proj2, std::false_type)
+            {
+                if(SizedIterable<Rng1>() && SizedIterable<Rng2>())
+                    return search_fn::sized_impl(begin(rng1), end(rng1), distance(rng1),
+                        begin(rng2), end(rng2), distance(rng2), pred, proj1, proj2);
+                else
+                    return search_fn::impl(begin(rng1), end(rng1),
+                        begin(rng2), end(rng2), pred, proj1, proj2);
+            }
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            static range_iterator_t<Rng1> dispatch(Rng1 &rng1, Rng2 &rng2, C &pred, P1 &proj1,
+                P2 &proj2, std::true_type)
+            {
+                return search_fn::dispatch(begin(rng1), end(rng1), begin(rng2), end(rng2),
+                    pred, proj1, proj2, std::true_type());
+            }
+
+            // Plain equality on contiguous bytes
+            template<typename I1, typename S1, typename I2, typename S2, typename C, typename P1,
+                typename P2>
+            static I1 dispatch(I1 begin1, S1 end1, I2 begin2, S2 end2, C &, P1 &, P2 &,
+                std::true_type)
+            {
+                if(begin2 == end2)
+                    return begin1;
+                auto const n = distance(begin1, end1);
+                if(0 == n)
+                    return begin1;
+                auto const s = detail::byte_pointer(begin1);
+                auto const p = detail::byte_search(s, static_cast<std::size_t>(n),
+                    detail::byte_pointer(begin2), static_cast<std::size_t>(distance(begin2, end2)));
+                return begin1 + (p ? p - s : n);
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C, typename P1,
+                typename P2>
+            using byte_search_t = meta::and_<
+                std::is_same<C, equal_to>,
+                std::is_same<P1, ident>,
+                std::is_same<P2, ident>,
+                detail::is_byte_pointer_range<I1, S1>,
+                detail::is_byte_pointer_range<I2, S2>,
+                std::is_same<iterator_value_t<I1>, iterator_value_t<I2>>>;
         public:
             template<typename I1, typename S1, typename I2, typename S2,
                 typename C = equal_to, typename P1 = ident, typename P2 = ident,
@@ -173,12 +234,17 @@ namespace ranges
                 auto &&pred = invokable(pred_);
                 auto &&proj1 = invokable(proj1_);
                 auto &&proj2 = invokable(proj2_);
-                if(SizedIteratorRange<I1, S1>() && SizedIteratorRange<I2, S2>())
-                    return search_fn::sized_impl(std::move(begin1), std::move(end1), distance(begin1, end1),
-                        std::move(begin2), std::move(end2), distance(begin2, end2), pred, proj1, proj2);
-                else
-                    return search_fn::impl(std::move(begin1), std::move(end1),
-                        std::move(begin2), std::move(end2), pred, proj1, proj2);
+                return search_fn::dispatch(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), pred, proj1, proj2, byte_search_t<I1, S1, I2, S2, C, P1, P2>());
+            }
+
+            /// Returns the position of the first match found by \c searcher,
+            /// such as a `boyer_moore_horspool_searcher`.
+            template<typename I, typename S, typename Srch,
+                CONCEPT_REQUIRES_(Searcher<Srch const, I, S>())>
+            I operator()(I begin, S end, Srch const &searcher) const
+            {
+                return searcher(std::move(begin), std::move(end)).first;
             }
 
             template<typename Rng1, typename Rng2, typename C = equal_to, typename P1 = ident,
@@ -195,12 +261,16 @@ namespace ranges
                 auto &&pred = invokable(pred_);
                 auto &&proj1 = invokable(proj1_);
                 auto &&proj2 = invokable(proj2_);
-                if(SizedIterable<Rng1>() && SizedIterable<Rng2>())
-                    return search_fn::sized_impl(begin(rng1), end(rng1), distance(rng1),
-                        begin(rng2), end(rng2), distance(rng2), pred, proj1, proj2);
-                else
-                    return search_fn::impl(begin(rng1), end(rng1),
-                        begin(rng2), end(rng2), pred, proj1, proj2);
+                return search_fn::dispatch(rng1, rng2, pred, proj1, proj2,
+                    byte_search_t<I1, range_sentinel_t<Rng1>, I2, range_sentinel_t<Rng2>, C, P1, P2>());
+            }
+
+            /// \overload
+            template<typename Rng, typename Srch, typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>() && Searcher<Srch const, I, range_sentinel_t<Rng>>())>
+            I operator()(Rng & rng, Srch const &searcher) const
+            {
+                return searcher(begin(rng), end(rng)).first;
             }
         };
 
@@ -0,0 +1,480 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SEARCHERS_HPP
+#define RANGES_V3_ALGORITHM_SEARCHERS_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \ingroup group-concepts
+        /// A searcher is called with the bounds of a range and returns the
+        /// bounds of the first match in it, or an empty range at its end if
+        /// there is none.
+        template<typename F, typename I, typename S = I>
+        using Searcher = meta::and_<
+            ForwardIterator<I>,
+            IteratorRange<I, S>,
+            Function<F, I, S>,
+            Convertible<concepts::Function::result_t<F, I, S>, std::pair<I, I>>>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename T>
+            using is_byte = meta::or_<
+                std::is_same<T, char>,
+                std::is_same<T, signed char>,
+                std::is_same<T, unsigned char>>;
+
+            // Iterators over byte-sized elements that are known to be contiguous,
+            // for which the standard C memory functions can be used.
+            template<typename I, typename V = iterator_value_t<I>>
+            using is_byte_pointer_iterator = meta::and_<
+                is_byte<V>,
+                meta::or_<
+                    std::is_same<I, V *>,
+                    std::is_same<I, V const *>,
+                    std::is_same<I, typename std::vector<V>::iterator>,
+                    std::is_same<I, typename std::vector<V>::const_iterator>,
+                    meta::and_<
+                        std::is_same<V, char>,
+                        meta::or_<
+                            std::is_same<I, std::string::iterator>,
+                            std::is_same<I, std::string::const_iterator>>>>>;
+
+            template<typename I, typename S>
+            using is_byte_pointer_range = meta::and_<
+                is_byte_pointer_iterator<I>,
+                SizedIteratorRange<I, S>>;
+
+            template<typename I>
+            unsigned char const *byte_pointer(I const &it)
+            {
+                return reinterpret_cast<unsigned char const *>(&*it);
+            }
+
+            // Finds the first occurrence of [pat, pat + m) in [s, s + n), or
+            // returns nullptr. Candidates are filtered by comparing both the
+            // first and the last byte of the pattern, 16 positions at a time
+            // where SSE2 is available, and only the survivors are compared
+            // with memcmp.
+            inline unsigned char const *byte_search(unsigned char const *s, std::size_t n,
+                unsigned char const *pat, std::size_t m)
+            {
+                if(0 == m)
+                    return s;
+                if(n < m)
+                    return nullptr;
+                if(1 == m)
+                    return static_cast<unsigned char const *>(std::memchr(s, *pat, n));
+                unsigned char const first = pat[0], last = pat[m - 1];
+                // Candidate positions are [0, end)
+                std::size_t const end = n - m + 1;
+                std::size_t i = 0;
+            #if defined(__SSE2__)
+                __m128i const vfirst = _mm_set1_epi8(static_cast<char>(first));
+                __m128i const vlast = _mm_set1_epi8(static_cast<char>(last));
+                for(; i + 16 <= end; i += 16)
+                {
+                    __m128i const bfirst =
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i));
+                    __m128i const blast =
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i + m - 1));
+                    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(
+                        _mm_cmpeq_epi8(bfirst, vfirst), _mm_cmpeq_epi8(blast, vlast))));
+                    while(0 != mask)
+                    {
+                        std::size_t const j = i + static_cast<std::size_t>(__builtin_ctz(mask));
+                        if(0 == std::memcmp(s + j + 1, pat + 1, m - 2))
+                            return s + j;
+                        mask &= mask - 1;
+                    }
+                }
+            #endif
+                for(; i < end; ++i)
+                {
+                    auto const p = static_cast<unsigned char const *>(
+                        std::memchr(s + i, first, end - i));
+                    if(!p)
+                        break;
+                    i = static_cast<std::size_t>(p - s);
+                    if(p[m - 1] == last && 0 == std::memcmp(p + 1, pat + 1, m - 2))
+                        return p;
+                }
+                return nullptr;
+            }
+
+            template<typename I, typename V>
+            std::pair<I, I> byte_search(I begin, iterator_difference_t<I> n,
+                std::vector<V> const &pat)
+            {
+                if(0 == n)
+                    return {begin, begin};
+                auto const s = detail::byte_pointer(begin);
+                auto const p = detail::byte_search(s, static_cast<std::size_t>(n),
+                    reinterpret_cast<unsigned char const *>(pat.data()), pat.size());
+                if(!p)
+                {
+                    begin += n;
+                    return {begin, begin};
+                }
+                begin += p - s;
+                return {begin, begin + static_cast<iterator_difference_t<I>>(pat.size())};
+            }
+
+            // The shift of the Horspool bad-character rule, indexed by element.
+            template<typename V, bool IsByte = is_byte<V>::value>
+            struct horspool_skip_table
+            {
+            private:
+                std::unordered_map<V, std::ptrdiff_t> skip_;
+                std::ptrdiff_t default_;
+            public:
+                explicit horspool_skip_table(std::ptrdiff_t m)
+                  : skip_{}, default_(m)
+                {}
+                void set(V const &v, std::ptrdiff_t d)
+                {
+                    skip_[v] = d;
+                }
+                std::ptrdiff_t operator[](V const &v) const
+                {
+                    auto it = skip_.find(v);
+                    return it == skip_.end() ? default_ : it->second;
+                }
+            };
+
+            template<typename V>
+            struct horspool_skip_table<V, true>
+            {
+            private:
+                std::array<std::ptrdiff_t, 256> skip_;
+            public:
+                explicit horspool_skip_table(std::ptrdiff_t m)
+                {
+                    skip_.fill(m);
+                }
+                void set(V v, std::ptrdiff_t d)
+                {
+                    skip_[static_cast<unsigned char>(v)] = d;
+                }
+                std::ptrdiff_t operator[](V v) const
+                {
+                    return skip_[static_cast<unsigned char>(v)];
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Searches by comparing the pattern at every position, which needs only
+        /// forward iterators and equality. For contiguous byte data, candidate
+        /// positions are first filtered on the first and last byte of the
+        /// pattern, 16 at a time with SSE2, so that most of the data is
+        /// skipped without a call to `memcmp`.
+        template<typename V>
+        struct default_searcher
+        {
+        private:
+            std::vector<V> pat_;
+
+            template<typename I, typename S>
+            std::pair<I, I> search(I begin, S end, std::false_type) const
+            {
+                auto const pat_begin = pat_.begin(), pat_end = pat_.end();
+                if(pat_begin == pat_end)
+                    return {begin, begin};
+                for(;; ++begin)
+                {
+                    I it = begin;
+                    for(auto p = pat_begin;; ++it, ++p)
+                    {
+                        if(p == pat_end)
+                            return {begin, it};
+                        if(it == end)
+                            return {it, it};
+                        if(!(*it == *p))
+                            break;
+                    }
+                }
+            }
+            template<typename I, typename S>
+            std::pair<I, I> search(I begin, S end, std::true_type) const
+            {
+                auto const n = distance(begin, end);
+                return detail::byte_search(std::move(begin), n, pat_);
+            }
+        public:
+            default_searcher() = default;
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() && Convertible<range_reference_t<Rng>, V>())>
+            explicit default_searcher(Rng && pattern)
+              : pat_(ranges::begin(pattern), ranges::end(pattern))
+            {}
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
+                    EqualityComparable<iterator_reference_t<I>, V const &>())>
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                return this->search(std::move(begin), std::move(end), meta::and_<
+                    detail::is_byte_pointer_range<I, S>,
+                    std::is_same<iterator_value_t<I>, V>>());
+            }
+        };
+
+        /// The Boyer-Moore-Horspool algorithm: the pattern is compared at a
+        /// window of the haystack, and the window then skips ahead by a
+        /// distance looked up by the window's last element. Sublinear on
+        /// average for long patterns over large alphabets, but O(N*M) in the
+        /// worst case. Needs random-access iterators, and elements that
+        /// `std::hash` can hash (unless they are bytes, which index a table).
+        template<typename V>
+        struct boyer_moore_horspool_searcher
+        {
+        private:
+            std::vector<V> pat_;
+            detail::horspool_skip_table<V> skip_;
+        public:
+            boyer_moore_horspool_searcher()
+              : pat_{}, skip_{0}
+            {}
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() && Convertible<range_reference_t<Rng>, V>())>
+            explicit boyer_moore_horspool_searcher(Rng && pattern)
+              : pat_(ranges::begin(pattern), ranges::end(pattern))
+              , skip_{static_cast<std::ptrdiff_t>(pat_.size())}
+            {
+                std::ptrdiff_t const m = static_cast<std::ptrdiff_t>(pat_.size());
+                for(std::ptrdiff_t i = 0; i < m - 1; ++i)
+                    skip_.set(pat_[static_cast<std::size_t>(i)], m - 1 - i);
+            }
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    EqualityComparable<iterator_reference_t<I>, V const &>())>
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                using D = iterator_difference_t<I>;
+                D const n = distance(begin, end);
+                D const m = static_cast<D>(pat_.size());
+                if(0 == m)
+                    return {begin, begin};
+                V const &pat_last = pat_.back();
+                auto const y = uncounted(begin);
+                for(D pos = 0; pos <= n - m;)
+                {
+                    auto &&x = *(y + (pos + (m - 1)));
+                    if(x == pat_last)
+                    {
+                        D i = 0;
+                        while(i < m - 1 && *(y + (pos + i)) == pat_[static_cast<std::size_t>(i)])
+                            ++i;
+                        if(i == m - 1)
+                            return {begin + pos, begin + (pos + m)};
+                    }
+                    pos += static_cast<D>(skip_[x]);
+                }
+                begin += n;
+                return {begin, begin};
+            }
+        };
+
+        /// The Two-Way algorithm of Crochemore and Perrin. The pattern is split
+        /// at a critical factorization computed from its maximal suffixes, which
+        /// lets the search run in O(N+M) time in the worst case with O(1) extra
+        /// space, and without a table indexed by element. Needs random-access
+        /// iterators, and totally ordered elements.
+        template<typename V>
+        struct two_way_searcher
+        {
+        private:
+            std::vector<V> pat_;
+            // The critical position (the last index of the left factor, or -1)
+            std::ptrdiff_t ell_;
+            // The period of the pattern, or a lower bound on it when !periodic_
+            std::ptrdiff_t per_;
+            bool periodic_;
+
+            // Returns the start of the maximal suffix of the pattern, minus one,
+            // with respect to the ordering <, or to > if Reversed. Sets p to the
+            // period of that suffix.
+            template<bool Reversed>
+            std::ptrdiff_t maximal_suffix(std::ptrdiff_t &p) const
+            {
+                std::ptrdiff_t const m = static_cast<std::ptrdiff_t>(pat_.size());
+                std::ptrdiff_t ms = -1, j = 0, k = 1;
+                p = 1;
+                while(j + k < m)
+                {
+                    V const &a = pat_[static_cast<std::size_t>(j + k)];
+                    V const &b = pat_[static_cast<std::size_t>(ms + k)];
+                    if(Reversed ? b < a : a < b)
+                    {
+                        j += k;
+                        k = 1;
+                        p = j - ms;
+                    }
+                    else if(a == b)
+                    {
+                        if(k != p)
+                            ++k;
+                        else
+                        {
+                            j += p;
+                            k = 1;
+                        }
+                    }
+                    else
+                    {
+                        ms = j;
+                        j = ms + 1;
+                        k = p = 1;
+                    }
+                }
+                return ms;
+            }
+        public:
+            two_way_searcher()
+              : pat_{}, ell_(-1), per_(1), periodic_(false)
+            {}
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() && Convertible<range_reference_t<Rng>, V>() &&
+                    TotallyOrdered<V>())>
+            explicit two_way_searcher(Rng && pattern)
+              : pat_(ranges::begin(pattern), ranges::end(pattern)), ell_(-1), per_(1)
+              , periodic_(false)
+            {
+                std::ptrdiff_t const m = static_cast<std::ptrdiff_t>(pat_.size());
+                std::ptrdiff_t p, q;
+                std::ptrdiff_t const i = this->maximal_suffix<false>(p);
+                std::ptrdiff_t const j = this->maximal_suffix<true>(q);
+                if(i > j)
+                {
+                    ell_ = i;
+                    per_ = p;
+                }
+                else
+                {
+                    ell_ = j;
+                    per_ = q;
+                }
+                // The pattern is periodic if its left factor recurs one period on.
+                periodic_ = per_ + ell_ + 1 <= m &&
+                    std::equal(pat_.begin(), pat_.begin() + (ell_ + 1), pat_.begin() + per_);
+                if(!periodic_)
+                    per_ = (std::max)(ell_ + 1, m - ell_ - 1) + 1;
+            }
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                    EqualityComparable<iterator_reference_t<I>, V const &>())>
+            std::pair<I, I> operator()(I begin, S end) const
+            {
+                using D = iterator_difference_t<I>;
+                D const n = distance(begin, end);
+                std::ptrdiff_t const m = static_cast<std::ptrdiff_t>(pat_.size());
+                if(0 == m)
+                    return {begin, begin};
+                auto const x = [this](std::ptrdiff_t i) -> V const &
+                {
+                    return pat_[static_cast<std::size_t>(i)];
+                };
+                auto const y = uncounted(begin);
+                // How much of the pattern's prefix is known to match at pos,
+                // in the periodic case
+                std::ptrdiff_t memory = -1;
+                for(D pos = 0; pos <= n - m;)
+                {
+                    // Match the right factor left to right...
+                    std::ptrdiff_t i = (std::max)(ell_, periodic_ ? memory : -1) + 1;
+                    while(i < m && *(y + (pos + i)) == x(i))
+                        ++i;
+                    if(i < m)
+                    {
+                        pos += i - ell_;
+                        memory = -1;
+                        continue;
+                    }
+                    // ...then the left factor right to left.
+                    std::ptrdiff_t const stop = periodic_ ? memory : -1;
+                    i = ell_;
+                    while(i > stop && *(y + (pos + i)) == x(i))
+                        --i;
+                    if(i <= stop)
+                        return {begin + pos, begin + (pos + m)};
+                    pos += per_;
+                    if(periodic_)
+                        memory = m - per_ - 1;
+                }
+                begin += n;
+                return {begin, begin};
+            }
+        };
+
+        /// \cond
+        template<template<typename> class Searcher_>
+        struct make_searcher_fn
+        {
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>())>
+            Searcher_<range_value_t<Rng>> operator()(Rng && pattern) const
+            {
+                return Searcher_<range_value_t<Rng>>{std::forward<Rng>(pattern)};
+            }
+        };
+        /// \endcond
+
+        /// \ingroup group-algorithms
+        /// \sa `default_searcher`
+        /// \sa `boyer_moore_horspool_searcher`
+        /// \sa `two_way_searcher`
+        namespace
+        {
+            constexpr auto&& make_default_searcher =
+                static_const<with_braced_init_args<make_searcher_fn<default_searcher>>>::value;
+            constexpr auto&& make_boyer_moore_horspool_searcher =
+                static_const<with_braced_init_args<
+                    make_searcher_fn<boyer_moore_horspool_searcher>>>::value;
+            constexpr auto&& make_two_way_searcher =
+                static_const<with_braced_init_args<make_searcher_fn<two_way_searcher>>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -14,6 +14,7 @@
 #define RANGES_V3_ALGORITHM_SHUFFLE_HPP
 
 #include <random>
+#include <cstdint>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -24,6 +25,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/random.hpp>
 
 namespace ranges
 {
@@ -48,10 +50,115 @@ namespace ranges
         using UniformRandomNumberGenerator = concepts::models<concepts::UniformRandomNumberGenerator, Gen>;
         /// @}
 
+        /// \cond
+        namespace detail
+        {
+            // Fisher-Yates, from the back. While the bounds fit in 32 bits, each
+            // 64-bit random word yields the indices of two steps.
+            template<typename I, typename Words>
+            void fisher_yates(I begin, iterator_difference_t<I> n, Words &words)
+            {
+                using D = iterator_difference_t<I>;
+                std::uint64_t const batch_limit = std::uint64_t(1) << 32;
+                D i = n - 1;
+                for(; i > 0 && static_cast<std::uint64_t>(i) >= batch_limit; --i)
+                {
+                    auto const j = detail::bounded_random(words, static_cast<std::uint64_t>(i) + 1);
+                    ranges::iter_swap(begin + i, begin + static_cast<D>(j));
+                }
+                for(; i > 1; i -= 2)
+                {
+                    std::uint64_t j1, j2;
+                    detail::bounded_random_2(words, static_cast<std::uint64_t>(i) + 1,
+                        static_cast<std::uint64_t>(i), j1, j2);
+                    ranges::iter_swap(begin + i, begin + static_cast<D>(j1));
+                    ranges::iter_swap(begin + (i - 1), begin + static_cast<D>(j2));
+                }
+                if(1 == i)
+                    ranges::iter_swap(begin + 1, begin + static_cast<D>(detail::bounded_random(words, 2)));
+            }
+
+            // Given uniformly shuffled [begin, mid) and [mid, end), uniformly
+            // shuffles [begin, end): elements are taken from either part by coin
+            // flips until one runs out, and the rest are inserted at random
+            // positions (Bacher, Bodini, Hollender and Lumbroso, "MergeShuffle").
+            template<typename I, typename Words>
+            void merge_shuffle_merge(I begin, iterator_difference_t<I> mid,
+                iterator_difference_t<I> n, Words &words)
+            {
+                using D = iterator_difference_t<I>;
+                detail::random_bits<Words> coin(words);
+                D i = 0, j = mid;
+                while(true)
+                {
+                    if(coin())
+                    {
+                        if(j == n)
+                            break;
+                        ranges::iter_swap(begin + i, begin + j);
+                        ++j;
+                    }
+                    else if(i == j)
+                        break;
+                    ++i;
+                }
+                for(; i < n; ++i)
+                {
+                    auto const k = detail::bounded_random(words, static_cast<std::uint64_t>(i) + 1);
+                    ranges::iter_swap(begin + i, begin + static_cast<D>(k));
+                }
+            }
+
+            // The number of elements below which the parallel shuffle shuffles
+            // blocks rather than merging them
+            constexpr std::ptrdiff_t merge_shuffle_block = 1 << 16;
+
+            // The result depends only on the size of the range and the seed, not
+            // on the number of threads: the range is cut into a power of two of
+            // blocks by size alone, and every block and every merge draws from a
+            // stream of its own, derived from the seed and its position.
+            template<typename I>
+            void merge_shuffle(parallel_policy const &policy, I begin, iterator_difference_t<I> n,
+                std::uint64_t seed)
+            {
+                using D = iterator_difference_t<I>;
+                std::size_t blocks = 1;
+                while(static_cast<D>(blocks) * merge_shuffle_block < n)
+                    blocks *= 2;
+                auto const stream = [=](std::size_t level, std::size_t k)
+                {
+                    detail::splitmix64 mix{seed ^ (static_cast<std::uint64_t>(level) << 56)};
+                    mix.state += static_cast<std::uint64_t>(k) * 0xD1B54A32D192ED03u;
+                    return detail::splitmix64{mix()};
+                };
+                detail::parallel_for(policy, blocks, [&](std::size_t k)
+                {
+                    auto const r = detail::static_chunk(n, blocks, k);
+                    auto gen = stream(0, k);
+                    detail::fisher_yates(begin + r.first, r.second - r.first, gen);
+                });
+                for(std::size_t level = 1, width = 2; width <= blocks; ++level, width *= 2)
+                {
+                    detail::parallel_for(policy, blocks / width, [&](std::size_t k)
+                    {
+                        auto const lo = detail::static_chunk(n, blocks, k * width).first;
+                        auto const mid = detail::static_chunk(n, blocks, k * width + width / 2).first;
+                        auto const hi = detail::static_chunk(n, blocks, k * width + width - 1).second;
+                        auto gen = stream(level, k);
+                        detail::merge_shuffle_merge(begin + lo, mid - lo, hi - lo, gen);
+                    });
+                }
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct shuffle_fn
         {
+            /// Shuffles with Fisher-Yates, drawing each index with Lemire's
+            /// nearly divisionless method, and two indices per 64-bit random
+            /// word where they fit.
             template<typename I, typename S, typename Gen,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() &&
                                   Permutable<I>() &&
@@ -65,14 +172,8 @@ namespace ranges
                 auto d = end - begin;
                 if(d > 1)
                 {
-                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
-                    std::uniform_int_distribution<std::ptrdiff_t> uid;
-                    for(--end, --d; begin < end; ++begin, --d)
-                    {
-                        auto i = uid(gen, param_t{0, d});
-                        if(i != 0)
-                            ranges::iter_swap(begin, begin + i);
-                    }
+                    detail::random_words<uncvref_t<Gen>> words(gen);
+                    detail::fisher_yates(begin, d, words);
                 }
                 return end;
             }
@@ -88,6 +189,36 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::forward<Gen>(rand));
             }
+
+            /// Shuffles large ranges in parallel with MergeShuffle: blocks are
+            /// shuffled independently and then merged pairwise. Takes a single
+            /// 64-bit word from \c gen as a seed, and for a given seed the
+            /// result is the same whatever the number of threads, though it
+            /// differs from that of the sequential overload.
+            template<typename I, typename S, typename Gen,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() &&
+                                  Permutable<I>() &&
+                                  UniformRandomNumberGenerator<Gen>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, Gen && gen) const
+            {
+                I end = ranges::next(begin, end_);
+                auto d = end - begin;
+                if(d > 1)
+                {
+                    detail::random_words<uncvref_t<Gen>> words(gen);
+                    detail::merge_shuffle(policy, begin, d, words());
+                }
+                return end;
+            }
+
+            template<typename Rng, typename Gen, typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() &&
+                                  Permutable<I>() &&
+                                  UniformRandomNumberGenerator<Gen>())>
+            I operator()(parallel_policy const &policy, Rng & rng, Gen && rand) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::forward<Gen>(rand));
+            }
         };
 
         /// \sa `shuffle_fn`
@@ -56,37 +56,42 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename Val, typename C>
-            inline Val const &median(Val const &a, Val const &b, Val const &c, C &pred)
+            // The one of a, b and c whose element is the median of the three
+            template<typename I, typename C, typename P>
+            inline I median(I a, I b, I c, C &pred, P &proj)
             {
-                if(pred(a, b))
-                    if(pred(b, c))
+                if(pred(proj(*a), proj(*b)))
+                    if(pred(proj(*b), proj(*c)))
                         return b;
-                    else if(pred(a, c))
+                    else if(pred(proj(*a), proj(*c)))
                         return c;
                     else
                         return a;
-                else if(pred(a, c))
+                else if(pred(proj(*a), proj(*c)))
                     return a;
-                else if(pred(b, c))
+                else if(pred(proj(*b), proj(*c)))
                     return c;
                 else
                     return b;
             }
 
-            template<typename I, typename Val, typename C, typename P>
-            inline I unguarded_partition(I begin, I end, Val const &pivot, C &pred, P &proj)
+            // The pivot is an element of the range, which the partition may
+            // swap; pivot follows it, so that the range is partitioned around
+            // the same value throughout.
+            template<typename I, typename C, typename P>
+            inline I unguarded_partition(I begin, I end, I pivot, C &pred, P &proj)
             {
                 while(true)
                 {
-                    while(pred(proj(*begin), pivot))
+                    while(pred(proj(*begin), proj(*pivot)))
                         ++begin;
                     --end;
-                    while(pred(pivot, proj(*end)))
+                    while(pred(proj(*pivot), proj(*end)))
                         --end;
                     if(!(begin < end))
                         return begin;
                     ranges::iter_swap(begin, end);
+                    pivot = pivot == begin ? end : pivot == end ? begin : pivot;
                     ++begin;
                 }
             }
@@ -175,8 +180,7 @@ namespace ranges
                     if(depth_limit == 0)
                         return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
                     I cut = detail::unguarded_partition(begin, end,
-                        detail::median(proj(*begin), proj(*(begin + (end - begin) / 2)),
-                            proj(*(end - 1)), pred),
+                        detail::median(begin, begin + (end - begin) / 2, end - 1, pred, proj),
                         pred, proj);
                     sort_fn::introsort_loop(cut, end, depth_limit - 1, pred, proj);
                     end = cut;
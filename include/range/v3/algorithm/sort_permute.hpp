@@ -0,0 +1,162 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SORT_PERMUTE_HPP
+#define RANGES_V3_ALGORITHM_SORT_PERMUTE_HPP
+
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Rearranges the first perm.size() elements at begin so that the
+            // i-th is the one that was at perm[i]: gathers them, in their new
+            // order, into a buffer, and moves them back. Elements that are
+            // lvalues in memory are prefetched a few gathers ahead.
+            template<typename I, typename Index>
+            void apply_permutation(I begin, std::vector<Index> const &perm)
+            {
+                static constexpr std::size_t prefetch_distance = 16;
+                using D = iterator_difference_t<I>;
+                std::size_t const n = perm.size();
+                std::vector<iterator_value_t<I>> buf;
+                buf.reserve(n);
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    if(i + prefetch_distance < n)
+                        detail::prefetch(begin + static_cast<D>(perm[i + prefetch_distance]));
+                    buf.push_back(iter_move(begin + static_cast<D>(perm[i])));
+                }
+                for(auto &v : buf)
+                {
+                    *begin = std::move(v);
+                    ++begin;
+                }
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Sorts `keys`, and rearranges the first `size(keys)` elements of each
+        /// of the other ranges the same way, as sorting `view::zip(keys,
+        /// rngs...)` by its first column would, but moving only the keys while
+        /// sorting. The keys are sorted paired with their original positions,
+        /// which gives the permutation; it is then applied to each of the other
+        /// ranges in turn, by one pass that gathers its elements into a buffer
+        /// in their new order, and one that moves them back. When the rows are
+        /// wider than the keys, that moves much less memory than sorting the
+        /// rows would. Like `sort`, it is not stable.
+        ///
+        /// To sort with a comparison other than `ordered_less`, pass it and a
+        /// projection (which may be `ident{}`) after the keys.
+        ///
+        /// \pre Each of `rngs...` has at least `size(keys)` elements.
+        struct sort_permute_fn
+        {
+        private:
+            template<typename Index, typename I, typename C, typename P, typename...Is>
+            static void impl(I begin, iterator_difference_t<I> n, C &pred, P &proj,
+                Is...rbegins)
+            {
+                using K = iterator_value_t<I>;
+                using Row = std::pair<K, Index>;
+                std::vector<Index> perm(static_cast<std::size_t>(n));
+                {
+                    std::vector<Row> rows;
+                    rows.reserve(static_cast<std::size_t>(n));
+                    I it = begin;
+                    for(Index i = 0; i < static_cast<Index>(n); ++i, ++it)
+                        rows.emplace_back(iter_move(it), i);
+                    ranges::sort(rows, std::ref(pred),
+                        [&](Row const &row) -> decltype(proj(row.first))
+                        {
+                            return proj(row.first);
+                        });
+                    it = begin;
+                    for(std::size_t i = 0; i < rows.size(); ++i, ++it)
+                    {
+                        *it = std::move(rows[i].first);
+                        perm[i] = rows[i].second;
+                    }
+                }
+                detail::ignore_unused((detail::apply_permutation(rbegins, perm), 42)...);
+            }
+
+        public:
+            template<typename Keys, typename...Rngs, typename I = range_iterator_t<Keys>,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterable<Keys>, SizedIterable<Keys>,
+                    RandomAccessIterable<Rngs>..., Sortable<I>,
+                    Permutable<range_iterator_t<Rngs>>...>())>
+            I operator()(Keys &&keys, Rngs &&...rngs) const
+            {
+                return (*this)(std::forward<Keys>(keys), ordered_less{}, ident{},
+                    std::forward<Rngs>(rngs)...);
+            }
+
+            template<typename Keys, typename C, typename P, typename...Rngs,
+                typename I = range_iterator_t<Keys>,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterable<Keys>, SizedIterable<Keys>,
+                    meta::not_<Iterable<C>>, RandomAccessIterable<Rngs>..., Sortable<I, C, P>,
+                    Permutable<range_iterator_t<Rngs>>...>())>
+            I operator()(Keys &&keys, C pred_, P proj_, Rngs &&...rngs) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                using D = iterator_difference_t<I>;
+                D const n = static_cast<D>(ranges::size(keys));
+                I const begin = ranges::begin(keys);
+                // Narrow positions halve the size of the sorted pairs of
+                // small keys.
+                if(static_cast<std::uint64_t>(n) <= (std::numeric_limits<std::uint32_t>::max)())
+                    sort_permute_fn::impl<std::uint32_t>(begin, n, pred, proj,
+                        ranges::begin(rngs)...);
+                else
+                    sort_permute_fn::impl<std::size_t>(begin, n, pred, proj,
+                        ranges::begin(rngs)...);
+                return begin + n;
+            }
+        };
+
+        /// \sa `sort_permute_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& sort_permute = static_const<sort_permute_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
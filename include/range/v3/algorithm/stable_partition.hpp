@@ -22,6 +22,7 @@
 #define RANGES_V3_ALGORITHM_STABLE_PARTITION_HPP
 
 #include <memory>
+#include <iterator>
 #include <functional>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
@@ -38,6 +39,7 @@
 #include <range/v3/algorithm/partition_move.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/aux_/compact_n.hpp>
 
 namespace ranges
 {
@@ -261,6 +263,18 @@ namespace ranges
                 return stable_partition_fn::impl(begin, end, pred, proj, len, p, bi);
             }
 
+            // Arithmetic elements are moved out of the buffer as bytes
+            template<typename T>
+            static T *buffer_source(T *buf, std::true_type)
+            {
+                return buf;
+            }
+            template<typename T>
+            static std::move_iterator<T *> buffer_source(T *buf, std::false_type)
+            {
+                return std::make_move_iterator(buf);
+            }
+
         public:
             template<typename I, typename S, typename C, typename P = ident,
                 CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && IteratorRange<I, S>())>
@@ -280,6 +294,65 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// Partitions stably in parallel, as a stream compaction: each thread
+            /// classifies a chunk of the range and moves it to a temporary
+            /// buffer, an exclusive scan of the counts of trues gives each
+            /// chunk's place in the result, and each thread moves its trues and
+            /// falses back to their places. The predicate is called once per
+            /// element, from several threads. Falls back to the sequential
+            /// algorithm if the buffer cannot be had, or if moving elements
+            /// might throw.
+            template<typename I, typename S, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(parallel_policy const &policy, I begin, S end_, C pred_,
+                P proj_ = P{}) const
+            {
+                using difference_type = iterator_difference_t<I>;
+                using value_type = iterator_value_t<I>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                I end = ranges::next(begin, end_);
+                difference_type const n = end - begin;
+                if(detail::parallel_chunks(policy, n) <= 1 ||
+                    !std::is_nothrow_move_constructible<value_type>::value)
+                    return stable_partition_fn::impl(begin, end, std::ref(pred), std::ref(proj),
+                        iterator_concept<I>());
+                auto const p = std::get_temporary_buffer<value_type>(n);
+                std::unique_ptr<value_type, detail::return_temporary_buffer> const h{p.first};
+                if(p.second < n)
+                    return stable_partition_fn::impl(begin, end, std::ref(pred), std::ref(proj),
+                        iterator_concept<I>());
+                value_type *const buf = p.first;
+                aux::parallel_compaction<difference_type> compaction(policy, n);
+                compaction.classify(policy, begin, pred, proj);
+                detail::parallel_for(policy, compaction.chunks, [&](std::size_t k)
+                {
+                    auto const r = compaction.bounds(k);
+                    for(difference_type i = r.first; i < r.second; ++i)
+                        ::new(static_cast<void *>(buf + i)) value_type(iter_move(begin + i));
+                });
+                compaction.scatter(policy,
+                    stable_partition_fn::buffer_source(buf, std::is_arithmetic<value_type>{}),
+                    begin, begin + compaction.total);
+                if(!std::is_trivially_destructible<value_type>::value)
+                    detail::parallel_for(policy, compaction.chunks, [&](std::size_t k)
+                    {
+                        auto const r = compaction.bounds(k);
+                        for(difference_type i = r.first; i < r.second; ++i)
+                            buf[i].~value_type();
+                    });
+                return begin + compaction.total;
+            }
+
+            template<typename Rng, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && RandomAccessIterable<Rng &>())>
+            I operator()(parallel_policy const &policy, Rng &rng, C pred, P proj = P{}) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `stable_partition_fn`
@@ -0,0 +1,133 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_TOP_K_HPP
+#define RANGES_V3_ALGORITHM_TOP_K_HPP
+
+#include <limits>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/nth_element.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \ingroup group-concepts
+        template<typename I, typename C = ordered_less, typename P = ident,
+            typename V = iterator_value_t<I>>
+        using TopKConcept = meta::fast_and<
+            InputIterator<I>,
+            Constructible<V, iterator_reference_t<I>>,
+            Sortable<typename std::vector<V>::iterator, C, P>>;
+
+        /// \cond
+        namespace detail
+        {
+            // Keeps at most 2k candidates. Whenever the buffer fills up, it is
+            // cut back to the best k with a selection, and the k-th best
+            // candidate becomes a threshold that rejects most later elements
+            // with a single comparison. That is O(N) expected time, versus
+            // O(N log k) for a bounded heap. The buffer is left to grow as
+            // elements arrive rather than reserved from k, so that a k far
+            // larger than the input costs no more than the input.
+            template<typename V, typename I, typename S, typename C, typename P>
+            std::vector<V> top_k(I begin, S end, iterator_difference_t<I> k, C &pred, P &proj)
+            {
+                std::vector<V> buf;
+                if(k <= 0)
+                    return buf;
+                std::size_t const n = static_cast<std::size_t>(k);
+                std::size_t const limit =
+                    n > std::numeric_limits<std::size_t>::max() / 2 ?
+                        std::numeric_limits<std::size_t>::max() : 2 * n;
+                bool full = false;
+                for(; begin != end; ++begin)
+                {
+                    auto &&x = *begin;
+                    if(full && !pred(proj(x), proj(buf[n - 1])))
+                        continue;
+                    buf.emplace_back((decltype(x) &&) x);
+                    if(buf.size() == limit)
+                    {
+                        ranges::nth_element(buf.begin(), buf.begin() + (k - 1), buf.end(),
+                            std::ref(pred), std::ref(proj));
+                        buf.erase(buf.begin() + k, buf.end());
+                        full = true;
+                    }
+                }
+                if(buf.size() > n)
+                {
+                    ranges::nth_element(buf.begin(), buf.begin() + (k - 1), buf.end(),
+                        std::ref(pred), std::ref(proj));
+                    buf.erase(buf.begin() + k, buf.end());
+                }
+                ranges::sort(buf, std::ref(pred), std::ref(proj));
+                return buf;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Returns, in sorted order, copies of the first \c k elements of the
+        /// input as if it had been sorted with \c pred and \c proj. The input
+        /// is traversed exactly once, so it may be a single-pass range, and
+        /// only O(min(k, N)) additional memory is used.
+        struct top_k_fn
+        {
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                typename V = iterator_value_t<I>,
+                CONCEPT_REQUIRES_(TopKConcept<I, C, P>() && IteratorRange<I, S>())>
+            std::vector<V>
+            operator()(I begin, S end, iterator_difference_t<I> k, C pred_ = C{},
+                P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return detail::top_k<V>(std::move(begin), std::move(end), k, pred, proj);
+            }
+
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>, typename V = iterator_value_t<I>,
+                CONCEPT_REQUIRES_(TopKConcept<I, C, P>() && Iterable<Rng>())>
+            std::vector<V>
+            operator()(Rng &&rng, iterator_difference_t<I> k, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), k, std::move(pred), std::move(proj));
+            }
+        };
+
+        /// \sa `top_k_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& top_k = static_const<with_braced_init_args<top_k_fn>>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -19,5 +19,7 @@
 #include <range/v3/action.hpp>
 #include <range/v3/numeric.hpp>
 #include <range/v3/view.hpp>
+#include <range/v3/eytzinger_index.hpp>
+#include <range/v3/soa_vector.hpp>
 
 #endif
@@ -56,6 +56,22 @@
 #endif
 #endif
 
+#ifndef RANGES_PREFETCH
+#if defined(__clang__) || defined(__GNUC__)
+#define RANGES_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define RANGES_PREFETCH(ADDR) ((void)(ADDR))
+#endif
+#endif
+
+#ifndef RANGES_NUMA_AFFINITY
+#if defined(__linux__)
+#define RANGES_NUMA_AFFINITY 1
+#else
+#define RANGES_NUMA_AFFINITY 0
+#endif
+#endif
+
 #if __cplusplus > 201103
 #define RANGES_DEPRECATED(MSG) [[deprecated(MSG)]]
 #else
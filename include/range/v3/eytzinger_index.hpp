@@ -0,0 +1,318 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_EYTZINGER_INDEX_HPP
+#define RANGES_V3_EYTZINGER_INDEX_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Positions in an Eytzinger layout are 1-based: the children of node
+            // k are 2k and 2k+1, and 0 is used as the past-the-end position.
+
+            // Undo the trailing right turns of a root-to-leaf descent, and then
+            // the left turn before them, to get the node at which the descent
+            // last went left.
+            inline std::size_t eytzinger_climb(std::size_t k)
+            {
+            #if defined(__clang__) || defined(__GNUC__)
+                return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+            #else
+                while(k & 1u)
+                    k >>= 1;
+                return k >> 1;
+            #endif
+            }
+
+            inline std::size_t eytzinger_first(std::size_t n)
+            {
+                std::size_t k = 0 == n ? 0 : 1;
+                while(0 != k && 2 * k <= n)
+                    k = 2 * k;
+                return k;
+            }
+
+            inline std::size_t eytzinger_last(std::size_t n)
+            {
+                std::size_t k = 0 == n ? 0 : 1;
+                while(0 != k && 2 * k + 1 <= n)
+                    k = 2 * k + 1;
+                return k;
+            }
+
+            inline std::size_t eytzinger_next(std::size_t k, std::size_t n)
+            {
+                if(2 * k + 1 <= n)
+                {
+                    k = 2 * k + 1;
+                    while(2 * k <= n)
+                        k = 2 * k;
+                    return k;
+                }
+                return eytzinger_climb(k);
+            }
+
+            inline std::size_t eytzinger_prev(std::size_t k, std::size_t n)
+            {
+                if(0 == k)
+                    return eytzinger_last(n);
+                if(2 * k <= n)
+                {
+                    k = 2 * k;
+                    while(2 * k + 1 <= n)
+                        k = 2 * k + 1;
+                    return k;
+                }
+                while(0 == (k & 1u))
+                    k >>= 1;
+                return k >> 1;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// A view of the elements of an `eytzinger_index` in sorted order.
+        template<typename T>
+        struct eytzinger_view
+          : range_facade<eytzinger_view<T>>
+        {
+        private:
+            friend range_access;
+            template<typename, typename, typename>
+            friend struct eytzinger_index;
+            T const *tree_;
+            std::size_t n_;
+
+            struct cursor
+            {
+            private:
+                T const *tree_;
+                std::size_t n_;
+                std::size_t k_;
+            public:
+                cursor() = default;
+                cursor(T const *tree, std::size_t n, std::size_t k)
+                  : tree_(tree), n_(n), k_(k)
+                {}
+                T const & current() const
+                {
+                    RANGES_ASSERT(0 != k_);
+                    return tree_[k_];
+                }
+                bool equal(cursor const &that) const
+                {
+                    return k_ == that.k_;
+                }
+                void next()
+                {
+                    RANGES_ASSERT(0 != k_);
+                    k_ = detail::eytzinger_next(k_, n_);
+                }
+                void prev()
+                {
+                    k_ = detail::eytzinger_prev(k_, n_);
+                    RANGES_ASSERT(0 != k_);
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {tree_, n_, detail::eytzinger_first(n_)};
+            }
+            cursor end_cursor() const
+            {
+                return {tree_, n_, 0};
+            }
+            // Positions are 1-based; tree[0] is never read.
+            eytzinger_view(T const *tree, std::size_t n)
+              : tree_(tree), n_(n)
+            {}
+        public:
+            using iterator = basic_iterator<cursor, cursor>;
+
+            eytzinger_view() = default;
+            std::size_t size() const
+            {
+                return n_;
+            }
+        };
+
+        /// A static search structure built from a sorted range. The elements are
+        /// stored in the order of a breadth-first traversal of a balanced binary
+        /// search tree (the Eytzinger layout, familiar from binary heaps). The
+        /// first levels of the tree, which every search visits, share a few cache
+        /// lines, and all 16 great-great-grandchildren of a node are adjacent in
+        /// memory. The search prefetches the cache line that holds the first of
+        /// them, and whichever of the others follow it on that line, while it
+        /// compares the intermediate levels. Searches are branchless. For tables
+        /// much larger than the cache, this is typically 2-4 times faster than
+        /// `lower_bound` over the sorted range; see perf/binary_search.cpp.
+        template<typename T, typename C = ordered_less, typename P = ident>
+        struct eytzinger_index
+        {
+        public:
+            using iterator = typename eytzinger_view<T>::iterator;
+        private:
+            // tree_[0] is unused, so that the children of k are at 2k and 2k+1.
+            std::vector<T> tree_;
+            semiregular_t<invokable_t<C>> pred_;
+            semiregular_t<invokable_t<P>> proj_;
+
+            template<typename I>
+            I build(I it, std::size_t k)
+            {
+                std::size_t const n = size();
+                if(k <= n)
+                {
+                    it = this->build(std::move(it), 2 * k);
+                    tree_[k] = *it;
+                    ++it;
+                    it = this->build(std::move(it), 2 * k + 1);
+                }
+                return it;
+            }
+
+            // Descend from the root, going right whenever Go says the element at
+            // k is before the position sought. Returns the position sought.
+            template<typename Go>
+            std::size_t search(Go go) const
+            {
+                // Prefetch the first of the 16 nodes four levels below k, which
+                // are adjacent. Its cache line holds as many of the others as fit
+                // after it; the storage is not aligned to cache lines, so that
+                // is all 16 only when they are small and happen to line up.
+                static constexpr std::size_t prefetch_distance = 16;
+                std::size_t const n = size();
+                T const *const tree = tree_.data();
+                std::size_t k = 1;
+                while(k <= n)
+                {
+                    if(prefetch_distance * k <= n)
+                        RANGES_PREFETCH(tree + prefetch_distance * k);
+                    k = 2 * k + static_cast<std::size_t>(go(tree[k]));
+                }
+                return detail::eytzinger_climb(k);
+            }
+
+            iterator make_iterator(std::size_t k) const
+            {
+                return {typename eytzinger_view<T>::cursor{tree_.data(), size(), k}};
+            }
+        public:
+            eytzinger_index() = default;
+            /// \pre `rng` is sorted with respect to `pred` and `proj`
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() && Convertible<range_reference_t<Rng>, T>())>
+            explicit eytzinger_index(Rng && rng, C pred = C{}, P proj = P{})
+              : tree_{}
+              , pred_(invokable(std::move(pred)))
+              , proj_(invokable(std::move(proj)))
+            {
+                std::vector<T> sorted(ranges::begin(rng), ranges::end(rng));
+                tree_.resize(sorted.size() + 1);
+                this->build(sorted.begin(), 1);
+            }
+            std::size_t size() const
+            {
+                return tree_.empty() ? 0 : tree_.size() - 1;
+            }
+            bool empty() const
+            {
+                return 0 == size();
+            }
+            /// The elements, in sorted order
+            eytzinger_view<T> sorted() const
+            {
+                return {tree_.empty() ? nullptr : tree_.data(), size()};
+            }
+            template<typename V>
+            iterator lower_bound(V const &val) const
+            {
+                auto &pred = pred_;
+                auto &proj = proj_;
+                return this->make_iterator(this->search([&](T const &t) -> bool
+                {
+                    return pred(proj(t), val);
+                }));
+            }
+            template<typename V>
+            iterator upper_bound(V const &val) const
+            {
+                auto &pred = pred_;
+                auto &proj = proj_;
+                return this->make_iterator(this->search([&](T const &t) -> bool
+                {
+                    return !pred(val, proj(t));
+                }));
+            }
+            template<typename V>
+            range<iterator> equal_range(V const &val) const
+            {
+                return {this->lower_bound(val), this->upper_bound(val)};
+            }
+            template<typename V>
+            bool contains(V const &val) const
+            {
+                std::size_t const k = this->search([&](T const &t) -> bool
+                {
+                    return pred_(proj_(t), val);
+                });
+                return 0 != k && !pred_(val, proj_(tree_[k]));
+            }
+        };
+
+        struct make_eytzinger_index_fn
+        {
+            /// \pre `rng` is sorted with respect to `pred` and `proj`
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                    IndirectInvokableRelation<C, Project<I, P>>())>
+            eytzinger_index<range_value_t<Rng>, C, P>
+            operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+            {
+                return eytzinger_index<range_value_t<Rng>, C, P>{std::forward<Rng>(rng),
+                    std::move(pred), std::move(proj)};
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `make_eytzinger_index_fn`
+        namespace
+        {
+            constexpr auto&& make_eytzinger_index =
+                static_const<with_braced_init_args<make_eytzinger_index_fn>>::value;
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -16,8 +16,11 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/range_fwd.hpp>
 
 namespace ranges
 {
@@ -40,6 +43,34 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(val));
             }
+
+            /// Assigns `val + i` to the \c i-th element, in parallel, each
+            /// thread its own chunk, starting from \c val advanced to the
+            /// chunk's first element; see the parallel `fill`.
+            template<typename O, typename S, class T,
+                CONCEPT_REQUIRES_(meta::and_<RandomAccessIterator<O>, IteratorRange<O, S>,
+                    OutputIterator<O, T>, RandomAccessIncrementable<T>>())>
+            O operator()(parallel_policy const &policy, O begin, S end, T val) const
+            {
+                using D = iterator_difference_t<O>;
+                D const n = ranges::next(begin, end) - begin;
+                detail::parallel_for_chunks(policy, n, [&](D lo, D hi)
+                {
+                    T v = val;
+                    v += static_cast<decltype(val - val)>(lo);
+                    for(O b = begin + lo, e = begin + hi; b != e; ++b, ++v)
+                        *b = v;
+                });
+                return begin + n;
+            }
+
+            template<typename Rng, class T, typename O = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && OutputIterable<Rng &, T>() &&
+                    RandomAccessIncrementable<T>())>
+            O operator()(parallel_policy const &policy, Rng &rng, T val) const
+            {
+                return (*this)(policy, begin(rng), end(rng), std::move(val));
+            }
         };
 
         namespace
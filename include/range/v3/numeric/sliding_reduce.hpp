@@ -0,0 +1,180 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_SLIDING_REDUCE_HPP
+#define RANGES_V3_NUMERIC_SLIDING_REDUCE_HPP
+
+#include <vector>
+#include <utility>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template <typename I, typename O, typename BOp,
+                  typename V = iterator_value_t<I>,
+                  typename Y = concepts::Invokable::result_t<BOp, V, V>>
+        using SlidingReducible = meta::fast_and<
+            InputIterator<I>,
+            WeakOutputIterator<O, V>,
+            CopyConstructible<V>,
+            Invokable<BOp, V, V>,
+            Assignable<V &, Y>>;
+
+        /// Writes, for each window of \c n consecutive elements of the input,
+        /// the elements of the window combined with \c bop, from the first
+        /// window to the one that ends at the last element. \c bop must be
+        /// associative. An input with fewer than \c n elements has no windows.
+        ///
+        /// Given \c inverse, such that `inverse(bop(x, y), x)` equals \c y, the
+        /// first window is combined element by element, and each window after
+        /// it is found from the one before in O(1), by removing its first
+        /// element with \c inverse and adding the new one with \c bop. This
+        /// reads each element twice, and needs a forward range.
+        ///
+        /// Without it, for operations such as `min` or `max` that have no
+        /// inverse, the window is kept as a queue made of two stacks: new
+        /// elements are pushed on the back stack, which keeps the combination
+        /// of its elements, and elements leave from the front stack, which
+        /// keeps, for each of its elements, the combination of that element
+        /// and the newer ones below it. When the front stack runs out, the
+        /// back stack is turned over into it, so that every element is
+        /// combined a constant number of times, and each window costs O(1)
+        /// amortized. This reads each element once, and works on input ranges.
+        struct sliding_reduce_fn
+        {
+            template <typename I, typename S, typename O, typename BOp,
+                      CONCEPT_REQUIRES_(IteratorRange<I, S>() &&
+                                        SlidingReducible<I, O, BOp>())>
+            std::pair<I, O>
+            operator()(I begin, S end, iterator_difference_t<I> n, O result,
+                       BOp bop_) const
+            {
+                RANGES_ASSERT(0 < n);
+                auto &&bop = invokable(bop_);
+                using V = iterator_value_t<I>;
+                coerce<V> v;
+
+                std::vector<V> front;
+                std::vector<V> back;
+                optional<V> back_sum;
+                iterator_difference_t<I> size = 0;
+                for(; begin != end; ++begin)
+                {
+                    if(size == n)
+                    {
+                        if(front.empty())
+                        {
+                            for(auto i = back.size(); i-- != 0;)
+                                front.push_back(front.empty() ? std::move(back[i]) :
+                                    V(bop(back[i], front.back())));
+                            back.clear();
+                            back_sum.reset();
+                        }
+                        front.pop_back();
+                    }
+                    else
+                        ++size;
+                    back.push_back(v(*begin));
+                    if(back_sum)
+                        *back_sum = bop(*back_sum, back.back());
+                    else
+                        back_sum = back.back();
+                    if(size == n)
+                    {
+                        if(front.empty())
+                            *result = *back_sum;
+                        else
+                            *result = V(bop(front.back(), *back_sum));
+                        ++result;
+                    }
+                }
+                return {begin, result};
+            }
+
+            template <typename I, typename S, typename O, typename BOp, typename Inv,
+                      CONCEPT_REQUIRES_(IteratorRange<I, S>() && ForwardIterator<I>() &&
+                                        SlidingReducible<I, O, BOp>() &&
+                                        SlidingReducible<I, O, Inv>())>
+            std::pair<I, O>
+            operator()(I begin, S end, iterator_difference_t<I> n, O result,
+                       BOp bop_, Inv inverse_) const
+            {
+                RANGES_ASSERT(0 < n);
+                auto &&bop = invokable(bop_);
+                auto &&inverse = invokable(inverse_);
+                using V = iterator_value_t<I>;
+                coerce<V> v;
+
+                if(begin == end)
+                    return {begin, result};
+                I last = begin;
+                auto t(v(*last));
+                iterator_difference_t<I> size = 1;
+                for(++last; size != n && last != end; ++last, ++size)
+                    t = bop(t, *last);
+                if(size != n)
+                    return {last, result};
+                *result = t;
+                for(++result; last != end; ++begin, ++last, ++result)
+                {
+                    t = inverse(t, *begin);
+                    t = bop(t, *last);
+                    *result = t;
+                }
+                return {last, result};
+            }
+
+            template <typename Rng, typename ORef, typename BOp,
+                      typename I = range_iterator_t<Rng>,
+                      typename O = uncvref_t<ORef>,
+                      CONCEPT_REQUIRES_(Iterable<Rng &>() &&
+                                        SlidingReducible<I, O, BOp>())>
+            std::pair<I, O>
+            operator()(Rng &rng, range_difference_t<Rng> n, ORef &&result, BOp bop) const
+            {
+                return (*this)(begin(rng), end(rng), n, std::forward<ORef>(result),
+                               std::move(bop));
+            }
+
+            template <typename Rng, typename ORef, typename BOp, typename Inv,
+                      typename I = range_iterator_t<Rng>,
+                      typename O = uncvref_t<ORef>,
+                      CONCEPT_REQUIRES_(ForwardIterable<Rng &>() &&
+                                        SlidingReducible<I, O, BOp>() &&
+                                        SlidingReducible<I, O, Inv>())>
+            std::pair<I, O>
+            operator()(Rng &rng, range_difference_t<Rng> n, ORef &&result, BOp bop,
+                       Inv inverse) const
+            {
+                return (*this)(begin(rng), end(rng), n, std::forward<ORef>(result),
+                               std::move(bop), std::move(inverse));
+            }
+        };
+
+        namespace
+        {
+            constexpr auto&& sliding_reduce = static_const<sliding_reduce_fn>::value;
+        }
+    }
+}
+
+#endif
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_RANGE_FWD_HPP
 #define RANGES_V3_RANGE_FWD_HPP
 
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 #include <range/v3/detail/config.hpp>
@@ -317,6 +318,55 @@ namespace ranges
         struct copy_tag {};
         struct move_tag {};
 
+        /// \addtogroup group-views
+        /// @{
+        /// Caching policies of the views that compute something lazily and
+        /// keep it, such as the begin of `view::remove_if` or the offset of a
+        /// `view::stride` iterator. Each view defaults to the policy that
+        /// matches what it did before the policies existed: `view::stride` to
+        /// \c shared_cache, since its iterators always kept their offsets in
+        /// atomics, and the others to \c single_threaded_cache.
+        ///
+        /// With a \c single_threaded_cache, the cache is kept in plain
+        /// members, and filling it is a write: threads must not share the
+        /// view (or iterator) that holds it until it is filled. A view's cache
+        /// is filled by calling its `begin()` once; after that, threads can
+        /// share the view. With a \c shared_cache, filling the cache is
+        /// synchronized, so threads can share the view from the start.
+        struct single_threaded_cache {};
+        struct shared_cache {};
+        /// @}
+
+        struct parallel_policy;
+
+        /// \cond
+        namespace detail
+        {
+            // The thread and NUMA code behind the parallel overloads of the
+            // algorithms. It is defined in <range/v3/utility/parallel.hpp>,
+            // with parallel_policy and par, so any code that has a policy to
+            // call a parallel overload with has included it.
+            template<typename D>
+            std::pair<D, D> static_chunk(D n, std::size_t chunks, std::size_t k);
+
+            inline std::size_t parallel_chunks(parallel_policy const &policy, std::ptrdiff_t n);
+
+            template<typename Fun>
+            void parallel_for(parallel_policy const &policy, std::size_t tasks, Fun &&fun);
+
+            template<typename D, typename Fun>
+            void parallel_for_chunks(parallel_policy const &policy, D n, Fun &&fun);
+
+            template<typename D, typename Partial, typename Combine>
+            auto parallel_reduce(parallel_policy const &policy, D n, Partial &&partial,
+                Combine &&combine) -> decltype(partial(n, n));
+
+            template<typename D, typename Find>
+            D parallel_find_first(parallel_policy const &policy, D n, Find &&find,
+                std::ptrdiff_t block = std::ptrdiff_t(1) << 12);
+        }
+        /// \endcond
+
         template<typename T>
         struct iterator_category_type;
 
@@ -416,6 +466,30 @@ namespace ranges
             struct bounded_fn;
         }
 
+        template<typename Rng>
+        struct cache1_view;
+
+        namespace view
+        {
+            struct cache1_fn;
+        }
+
+        template<typename...Rngs>
+        struct cartesian_product_view;
+
+        namespace view
+        {
+            struct cartesian_product_fn;
+        }
+
+        template<typename Rng>
+        struct chunk_view;
+
+        namespace view
+        {
+            struct chunk_fn;
+        }
+
         template<typename Rng>
         struct const_view;
 
@@ -439,6 +513,14 @@ namespace ranges
         using counted_sentinel =
             basic_sentinel<detail::counted_sentinel>;
 
+        template<typename Rng>
+        struct drop_view;
+
+        namespace view
+        {
+            struct drop_fn;
+        }
+
         template<typename T>
         struct empty_view;
 
@@ -455,12 +537,27 @@ namespace ranges
             struct filter_fn;
         }
 
+        template<typename Rng, typename F>
+        struct for_each_view;
+
+        namespace view
+        {
+            struct for_each_fn;
+        }
+
+        template<typename Val>
+        struct maybe_view;
+
         template<typename Rng, typename Fun>
         struct group_by_view;
 
+        template<typename Rng, typename Fun>
+        struct group_by_sorted_view;
+
         namespace view
         {
             struct group_by_fn;
+            struct group_by_sorted_fn;
         }
 
         template<typename Rng>
@@ -503,6 +600,22 @@ namespace ranges
             struct partial_sum_fn;
         }
 
+        template<typename Dist>
+        struct random_view;
+
+        namespace view
+        {
+            struct random_fn;
+        }
+
+        template<typename Rng>
+        struct memoize_view;
+
+        namespace view
+        {
+            struct memoize_fn;
+        }
+
         template<typename Rng>
         struct move_view;
 
@@ -511,6 +624,14 @@ namespace ranges
             struct move_fn;
         }
 
+        template<typename Rng, typename Pred, typename Cache>
+        struct remove_if_view;
+
+        namespace view
+        {
+            struct remove_if_fn;
+        }
+
         template<typename Val>
         struct repeat_view;
 
@@ -527,7 +648,15 @@ namespace ranges
             struct reverse_fn;
         }
 
-        template<typename Rng>
+        template<typename Rng, typename Srch>
+        struct search_all_view;
+
+        namespace view
+        {
+            struct search_all_fn;
+        }
+
+        template<typename Rng, typename Cache = single_threaded_cache>
         struct slice_view;
 
         namespace view
@@ -552,6 +681,14 @@ namespace ranges
         }
 
         template<typename Rng>
+        struct sliding_view;
+
+        namespace view
+        {
+            struct sliding_fn;
+        }
+
+        template<typename Rng, typename Cache = shared_cache>
         struct stride_view;
 
         namespace view
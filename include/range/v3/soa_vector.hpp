@@ -0,0 +1,353 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_SOA_VECTOR_HPP
+#define RANGES_V3_SOA_VECTOR_HPP
+
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/swap.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+#include <range/v3/utility/integer_sequence.hpp>
+#include <range/v3/utility/tuple_algorithm.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// A sequence of rows stored as a structure of arrays: one contiguous
+        /// column per element type. Its elements are those of `view::zip` over
+        /// the columns, with the same value, reference and rvalue reference
+        /// types, so it can be sorted, partitioned and searched like the zip.
+        /// Its iterators hold a pointer to each column and a single index, and
+        /// swap and move elements column by column, without forming tuples of
+        /// references, which is what the algorithms that permute elements
+        /// spend most of their time doing.
+        ///
+        /// Every operation that changes the number of rows changes that of
+        /// every column; if it throws, the number of rows is left as it was.
+        template<typename...Ts>
+        struct soa_vector
+        {
+            static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+        private:
+            std::tuple<std::vector<Ts>...> columns_;
+
+            template<bool Const>
+            struct cursor
+            {
+            private:
+                template<typename T>
+                using pointer_t = meta::if_c<Const, T const, T> *;
+                std::tuple<pointer_t<Ts>...> data_;
+                std::ptrdiff_t index_;
+
+                template<std::size_t...Is>
+                auto current_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    detail::indirect_zip_fn_{}((std::get<Is>(data_) + index_)...)
+                )
+                template<std::size_t...Is>
+                auto indirect_move_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    detail::indirect_zip_fn_{}(move_tag{}, (std::get<Is>(data_) + index_)...)
+                )
+                template<std::size_t...Is>
+                void indirect_swap_(cursor const &that, index_sequence<Is...>) const
+                {
+                    detail::ignore_unused(
+                        (ranges::swap(std::get<Is>(data_)[index_],
+                            std::get<Is>(that.data_)[that.index_]), 42)...);
+                }
+                friend auto indirect_move(basic_iterator<cursor, cursor> const &it)
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    get_cursor(it).indirect_move_(make_index_sequence<sizeof...(Ts)>{})
+                )
+                template<bool C = Const, CONCEPT_REQUIRES_(!C)>
+                friend void indirect_swap(basic_iterator<cursor, cursor> const &a,
+                    basic_iterator<cursor, cursor> const &b)
+                {
+                    get_cursor(a).indirect_swap_(get_cursor(b),
+                        make_index_sequence<sizeof...(Ts)>{});
+                }
+            public:
+                using difference_type = std::ptrdiff_t;
+                using value_type = decltype(detail::indirect_zip_fn_{}(copy_tag{},
+                    std::declval<pointer_t<Ts>>()...));
+
+                cursor() = default;
+                cursor(std::tuple<pointer_t<Ts>...> data, std::ptrdiff_t index)
+                  : data_(data), index_(index)
+                {}
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    current_(make_index_sequence<sizeof...(Ts)>{})
+                )
+                void next()
+                {
+                    ++index_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return index_ == that.index_;
+                }
+                void prev()
+                {
+                    --index_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    index_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.index_ - index_;
+                }
+            };
+
+            template<std::size_t...Is>
+            std::tuple<Ts *...> data_(index_sequence<Is...>)
+            {
+                return std::tuple<Ts *...>{std::get<Is>(columns_).data()...};
+            }
+            template<std::size_t...Is>
+            std::tuple<Ts const *...> data_(index_sequence<Is...>) const
+            {
+                return std::tuple<Ts const *...>{std::get<Is>(columns_).data()...};
+            }
+            // Drops the rows past the first n from whichever columns have them,
+            // after a column has thrown partway through an operation that
+            // changes the number of rows.
+            template<std::size_t...Is>
+            void truncate_(std::size_t n, index_sequence<Is...>)
+            {
+                detail::ignore_unused((std::get<Is>(columns_).size() > n ?
+                    (void) std::get<Is>(columns_).erase(
+                        std::get<Is>(columns_).begin() + static_cast<std::ptrdiff_t>(n),
+                        std::get<Is>(columns_).end()) :
+                    (void) 0, 42)...);
+            }
+            template<typename Fun>
+            void all_or_none_(Fun fun)
+            {
+                std::size_t const n = size();
+                try
+                {
+                    fun();
+                }
+                catch(...)
+                {
+                    this->truncate_(n, make_index_sequence<sizeof...(Ts)>{});
+                    throw;
+                }
+            }
+            template<typename Row, std::size_t...Is>
+            void push_back_(Row &&row, index_sequence<Is...>)
+            {
+                this->all_or_none_([&]
+                {
+                    detail::ignore_unused((std::get<Is>(columns_).push_back(
+                        std::get<Is>(std::forward<Row>(row))), 42)...);
+                });
+            }
+            template<std::size_t...Is, typename...Us>
+            void emplace_back_(index_sequence<Is...>, Us &&...us)
+            {
+                this->all_or_none_([&]
+                {
+                    detail::ignore_unused((std::get<Is>(columns_).emplace_back(
+                        std::forward<Us>(us)), 42)...);
+                });
+            }
+            template<std::size_t...Is>
+            void resize_(std::size_t n, index_sequence<Is...>)
+            {
+                this->all_or_none_([&]
+                {
+                    detail::ignore_unused((std::get<Is>(columns_).resize(n), 42)...);
+                });
+            }
+            template<std::size_t...Is>
+            void reserve_(std::size_t n, index_sequence<Is...>)
+            {
+                detail::ignore_unused((std::get<Is>(columns_).reserve(n), 42)...);
+            }
+            template<std::size_t...Is>
+            void pop_back_(index_sequence<Is...>)
+            {
+                detail::ignore_unused((std::get<Is>(columns_).pop_back(), 42)...);
+            }
+            template<typename Rng>
+            void reserve_for_(Rng &rows, std::true_type)
+            {
+                this->reserve(size() + static_cast<std::size_t>(ranges::size(rows)));
+            }
+            template<typename Rng>
+            void reserve_for_(Rng &, std::false_type)
+            {}
+        public:
+            using iterator = basic_iterator<cursor<false>, cursor<false>>;
+            using const_iterator = basic_iterator<cursor<true>, cursor<true>>;
+            using value_type = iterator_value_t<iterator>;
+            using reference = iterator_reference_t<iterator>;
+            using const_reference = iterator_reference_t<const_iterator>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            soa_vector() = default;
+            /// \c n rows of value-initialized elements
+            explicit soa_vector(std::size_t n)
+              : columns_(std::vector<Ts>(n)...)
+            {}
+            /// The rows of \c rows, each a tuple or pair of the columns' elements
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>() && !Same<uncvref_t<Rng>, soa_vector>())>
+            explicit soa_vector(Rng && rows)
+            {
+                this->append(rows);
+            }
+            iterator begin()
+            {
+                return {{this->data_(make_index_sequence<sizeof...(Ts)>{}), 0}};
+            }
+            iterator end()
+            {
+                return {{this->data_(make_index_sequence<sizeof...(Ts)>{}),
+                    static_cast<std::ptrdiff_t>(size())}};
+            }
+            const_iterator begin() const
+            {
+                return {{this->data_(make_index_sequence<sizeof...(Ts)>{}), 0}};
+            }
+            const_iterator end() const
+            {
+                return {{this->data_(make_index_sequence<sizeof...(Ts)>{}),
+                    static_cast<std::ptrdiff_t>(size())}};
+            }
+            std::size_t size() const
+            {
+                return std::get<0>(columns_).size();
+            }
+            bool empty() const
+            {
+                return 0 == size();
+            }
+            std::size_t capacity() const
+            {
+                return std::get<0>(columns_).capacity();
+            }
+            reference operator[](std::size_t i)
+            {
+                RANGES_ASSERT(i < size());
+                return *(begin() + static_cast<std::ptrdiff_t>(i));
+            }
+            const_reference operator[](std::size_t i) const
+            {
+                RANGES_ASSERT(i < size());
+                return *(begin() + static_cast<std::ptrdiff_t>(i));
+            }
+            /// The elements of the \c I-th column, which are contiguous
+            template<std::size_t I>
+            range<meta::at_c<meta::list<Ts...>, I> *> column()
+            {
+                auto &col = std::get<I>(columns_);
+                return {col.data(), col.data() + col.size()};
+            }
+            template<std::size_t I>
+            range<meta::at_c<meta::list<Ts...>, I> const *> column() const
+            {
+                auto &col = std::get<I>(columns_);
+                return {col.data(), col.data() + col.size()};
+            }
+            /// Reserves room for \c n rows in every column
+            void reserve(std::size_t n)
+            {
+                this->reserve_(n, make_index_sequence<sizeof...(Ts)>{});
+            }
+            void resize(std::size_t n)
+            {
+                this->resize_(n, make_index_sequence<sizeof...(Ts)>{});
+            }
+            void clear()
+            {
+                this->truncate_(0, make_index_sequence<sizeof...(Ts)>{});
+            }
+            void push_back(value_type const &row)
+            {
+                this->push_back_(row, make_index_sequence<sizeof...(Ts)>{});
+            }
+            void push_back(value_type &&row)
+            {
+                this->push_back_(std::move(row), make_index_sequence<sizeof...(Ts)>{});
+            }
+            /// Appends a row whose \c i-th element is constructed from the \c
+            /// i-th argument
+            template<typename...Us,
+                CONCEPT_REQUIRES_(sizeof...(Us) == sizeof...(Ts))>
+            void emplace_back(Us &&...us)
+            {
+                this->emplace_back_(make_index_sequence<sizeof...(Ts)>{}, std::forward<Us>(us)...);
+            }
+            /// Appends the rows of \c rows, each a tuple or pair of the columns'
+            /// elements, such as the elements of another `soa_vector` or of a
+            /// `view::zip`. Room for them is reserved up front if their number
+            /// is known.
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng>())>
+            void append(Rng && rows)
+            {
+                this->reserve_for_(rows, SizedIterable<Rng>());
+                this->all_or_none_([&]
+                {
+                    for(auto &&row : rows)
+                        this->push_back_(row, make_index_sequence<sizeof...(Ts)>{});
+                });
+            }
+            void pop_back()
+            {
+                RANGES_ASSERT(!empty());
+                this->pop_back_(make_index_sequence<sizeof...(Ts)>{});
+            }
+            void swap(soa_vector &that) noexcept
+            {
+                columns_.swap(that.columns_);
+            }
+            friend void swap(soa_vector &a, soa_vector &b) noexcept
+            {
+                a.swap(b);
+            }
+        };
+
+        /// @}
+    }
+}
+
+#endif
@@ -55,13 +55,17 @@ namespace ranges
             }
         };
 
+        /// Loads acquire and stores release, so that a value that is
+        /// published by storing to one `mutable_` is seen by whoever loads
+        /// it from another, without the cost of sequentially consistent
+        /// stores.
         template<typename T>
         struct mutable_<std::atomic<T>>
         {
             mutable std::atomic<T> value;
             mutable_() = default;
             mutable_(mutable_ const &that)
-              : value(static_cast<T>(that.value))
+              : value(static_cast<T>(that))
             {}
             constexpr explicit mutable_(T &&t)
               : value(detail::move(t))
@@ -71,22 +75,22 @@ namespace ranges
             {}
             mutable_ const &operator=(mutable_ const &that) const
             {
-                value = static_cast<T>(that.value);
+                value.store(static_cast<T>(that), std::memory_order_release);
                 return *this;
             }
             mutable_ const &operator=(T &&t) const
             {
-                value = std::move(t);
+                value.store(std::move(t), std::memory_order_release);
                 return *this;
             }
             mutable_ const &operator=(T const &t) const
             {
-                value = t;
+                value.store(t, std::memory_order_release);
                 return *this;
             }
             operator T() const
             {
-                return value;
+                return value.load(std::memory_order_acquire);
             }
             operator std::atomic<T> &() const &
             {
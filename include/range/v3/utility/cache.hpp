@@ -0,0 +1,123 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_CACHE_HPP
+#define RANGES_V3_UTILITY_CACHE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/box.hpp>
+#include <range/v3/utility/optional.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename T>
+            using is_cache_policy =
+                meta::or_<std::is_same<T, single_threaded_cache>, std::is_same<T, shared_cache>>;
+
+            // A member that const member functions can update, such as the
+            // offset of a stride iterator: plain, or atomic with a shared cache.
+            template<typename T, typename Cache>
+            using cache_cell_t =
+                meta::if_<std::is_same<Cache, shared_cache>, mutable_<std::atomic<T>>, mutable_<T>>;
+
+            // A value computed the first time it is asked for, such as the begin
+            // of a view that has to search for it. Copies start out empty.
+            template<typename T, typename Cache>
+            struct lazy_cache;
+
+            template<typename T>
+            struct lazy_cache<T, single_threaded_cache>
+            {
+            private:
+                optional<T> value_;
+            public:
+                lazy_cache() = default;
+                lazy_cache(lazy_cache const &)
+                  : value_{}
+                {}
+                lazy_cache &operator=(lazy_cache const &)
+                {
+                    value_.reset();
+                    return *this;
+                }
+                template<typename Fun>
+                T get(Fun fun)
+                {
+                    if(!value_)
+                        value_ = fun();
+                    return *value_;
+                }
+                void reset()
+                {
+                    value_.reset();
+                }
+            };
+
+            // The value is computed once under a lock; afterwards, getting it
+            // costs one acquiring load.
+            template<typename T>
+            struct lazy_cache<T, shared_cache>
+            {
+            private:
+                std::atomic<bool> ready_;
+                std::mutex mutex_;
+                optional<T> value_;
+            public:
+                lazy_cache()
+                  : ready_(false), mutex_{}, value_{}
+                {}
+                lazy_cache(lazy_cache const &)
+                  : lazy_cache()
+                {}
+                lazy_cache &operator=(lazy_cache const &)
+                {
+                    reset();
+                    return *this;
+                }
+                template<typename Fun>
+                T get(Fun fun)
+                {
+                    if(!ready_.load(std::memory_order_acquire))
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if(!ready_.load(std::memory_order_relaxed))
+                        {
+                            value_ = fun();
+                            ready_.store(true, std::memory_order_release);
+                        }
+                    }
+                    return *value_;
+                }
+                void reset()
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    ready_.store(false, std::memory_order_relaxed);
+                    value_.reset();
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -249,25 +249,31 @@ namespace ranges
             constexpr auto&& not_ = static_const<not_fn>::value;
         }
 
+        // The tags name the composed type, so that the boxes of a composed
+        // function that is itself composed are found apart from its own.
         template<typename Second, typename First>
         struct composed
-          : private box<Second, meta::size_t<0>>
-          , private box<First, meta::size_t<1>>
+          : private box<Second, meta::list<composed<Second, First>, meta::size_t<0>>>
+          , private box<First, meta::list<composed<Second, First>, meta::size_t<1>>>
         {
+        private:
+            using second_tag = meta::list<composed, meta::size_t<0>>;
+            using first_tag = meta::list<composed, meta::size_t<1>>;
+        public:
             composed() = default;
             composed(Second second, First first)
-              : box<Second, meta::size_t<0>>{std::move(second)}
-              , box<First, meta::size_t<1>>{std::move(first)}
+              : box<Second, second_tag>{std::move(second)}
+              , box<First, first_tag>{std::move(first)}
             {}
             template<typename...Ts>
             auto operator()(Ts &&...ts)
             RANGES_DECLTYPE_AUTO_RETURN(
-                ranges::get<0>(*this)(ranges::get<1>(*this)((Ts &&)ts)...)
+                ranges::get<second_tag>(*this)(ranges::get<first_tag>(*this)((Ts &&)ts)...)
             )
             template<typename...Ts>
             auto operator()(Ts &&...ts) const
             RANGES_DECLTYPE_AUTO_RETURN(
-                ranges::get<0>(*this)(ranges::get<1>(*this)((Ts &&)ts)...)
+                ranges::get<second_tag>(*this)(ranges::get<first_tag>(*this)((Ts &&)ts)...)
             )
         };
 
@@ -15,6 +15,7 @@
 #define RANGES_V3_UTILITY_ITERATOR_HPP
 
 #include <new>
+#include <memory>
 #include <utility>
 #include <iterator>
 #include <type_traits>
@@ -535,6 +536,25 @@ namespace ranges
         }
         /// \endcond
 
+        /// \cond
+        namespace detail
+        {
+            // Hint that the element at it will be read soon. Only possible when
+            // dereferencing yields an lvalue with an address.
+            template<typename I,
+                CONCEPT_REQUIRES_(std::is_lvalue_reference<iterator_reference_t<I>>())>
+            void prefetch(I const &it)
+            {
+                RANGES_PREFETCH(std::addressof(*it));
+            }
+
+            template<typename I,
+                CONCEPT_REQUIRES_(!std::is_lvalue_reference<iterator_reference_t<I>>())>
+            void prefetch(I const &)
+            {}
+        }
+        /// \endcond
+
         /// \addtogroup group-utility
         /// @{
         namespace
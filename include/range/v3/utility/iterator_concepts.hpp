@@ -276,6 +276,32 @@ namespace ranges
                     ));
             };
 
+            struct BidirectionalIncrementable
+              : refines<Incrementable>
+            {
+                template<typename T>
+                auto requires_(T t) -> decltype(
+                    concepts::valid_expr(
+                        concepts::has_type<T &>(--t),
+                        concepts::has_type<T>(t--)
+                    ));
+            };
+
+            struct RandomAccessIncrementable
+              : refines<BidirectionalIncrementable>
+            {
+                template<typename T>
+                auto requires_(T t) -> decltype(
+                    concepts::valid_expr(
+                        concepts::model_of<Integral>(t - t),
+                        concepts::has_type<T &>(t += (t - t)),
+                        concepts::has_type<T &>(t -= (t - t)),
+                        concepts::convertible_to<T>(t - (t - t)),
+                        concepts::convertible_to<T>(t + (t - t)),
+                        concepts::convertible_to<T>((t - t) + t)
+                    ));
+            };
+
             struct WeakIterator
               : refines<WeaklyIncrementable, Copyable>
             {
@@ -393,6 +419,12 @@ namespace ranges
         template<typename T>
         using Incrementable = concepts::models<concepts::Incrementable, T>;
 
+        template<typename T>
+        using BidirectionalIncrementable = concepts::models<concepts::BidirectionalIncrementable, T>;
+
+        template<typename T>
+        using RandomAccessIncrementable = concepts::models<concepts::RandomAccessIncrementable, T>;
+
         template<typename I>
         using WeakIterator = concepts::models<concepts::WeakIterator, I>;
 
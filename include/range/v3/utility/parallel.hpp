@@ -0,0 +1,363 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_PARALLEL_HPP
+#define RANGES_V3_UTILITY_PARALLEL_HPP
+
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <exception>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+#if RANGES_NUMA_AFFINITY
+#include <sched.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Selects the parallel overload of an algorithm, as in
+        /// `ranges::count_if(ranges::par, rng, pred)`. The work is split
+        /// statically into at most `concurrency()` contiguous chunks of nearly
+        /// equal size, in index order: of \c T chunks, chunk \c k is always
+        /// the elements `[n*k/T, n*(k+1)/T)`. So algorithms run with the same
+        /// policy over ranges of the same size split them at the same places.
+        /// A `pinned()` policy also runs each chunk on the same NUMA node every
+        /// time, so the pages of a chunk that one such algorithm first wrote
+        /// are local to the CPUs that the next one processes it on.
+        struct parallel_policy
+        {
+        private:
+            std::size_t threads_;
+            bool pinned_;
+        public:
+            /// Ranges smaller than this are not split; the per-thread start-up
+            /// cost would exceed the work.
+            static constexpr std::ptrdiff_t default_grain = 1 << 14;
+
+            /// \param threads The number of threads to use, or 0 to use one per
+            /// hardware thread
+            /// \param pinned Whether to run each chunk on the CPUs of one NUMA
+            /// node; see `pinned()`
+            explicit constexpr parallel_policy(std::size_t threads = 0, bool pinned = false)
+              : threads_(threads), pinned_(pinned)
+            {}
+            /// The number of threads that the parallel algorithms run with: the
+            /// count given to the constructor, or else one per hardware thread
+            std::size_t concurrency() const
+            {
+                if(0 != threads_)
+                    return threads_;
+                std::size_t const n = std::thread::hardware_concurrency();
+                return 0 == n ? 1 : n;
+            }
+            /// Whether each chunk runs on the CPUs of one NUMA node. Of \c T
+            /// chunks on a machine with \c N nodes, chunk \c k runs on node
+            /// `k*N/T`. The calling thread, which runs one of the chunks, gets
+            /// its own CPUs back when the algorithm returns. The topology is
+            /// read from /sys/devices/system/node; where it cannot be (outside
+            /// Linux, or with \c RANGES_NUMA_AFFINITY defined to 0), the
+            /// threads are not pinned.
+            constexpr bool pinned() const
+            {
+                return pinned_;
+            }
+        };
+
+        /// \cond
+        namespace detail
+        {
+            // The bounds of the k-th of chunks nearly equal parts of [0, n)
+            template<typename D>
+            std::pair<D, D> static_chunk(D n, std::size_t chunks, std::size_t k)
+            {
+                auto const bound = [=](std::size_t i) -> D
+                {
+                    // n * i / chunks, without overflowing for large n
+                    return static_cast<D>(n / static_cast<D>(chunks) * static_cast<D>(i) +
+                        n % static_cast<D>(chunks) * static_cast<D>(i) / static_cast<D>(chunks));
+                };
+                return {bound(k), bound(k + 1)};
+            }
+
+            // The number of chunks to split n elements into, so that every
+            // chunk but the last has at least parallel_policy::default_grain
+            // elements.
+            inline std::size_t parallel_chunks(parallel_policy const &policy, std::ptrdiff_t n)
+            {
+                std::ptrdiff_t const grain = parallel_policy::default_grain;
+                if(n <= grain)
+                    return 1;
+                std::size_t const by_size = static_cast<std::size_t>(n / grain);
+                std::size_t const threads = policy.concurrency();
+                return by_size < threads ? by_size : threads;
+            }
+
+            // The numbers in a sysfs list such as "0-3,8,10-11".
+            inline std::vector<int> parse_sysfs_list(std::string const &list)
+            {
+                std::vector<int> ids;
+                char const *p = list.c_str();
+                while(true)
+                {
+                    char *e;
+                    long const lo = std::strtol(p, &e, 10);
+                    if(e == p)
+                        break;
+                    long hi = lo;
+                    if('-' == *e)
+                    {
+                        p = e + 1;
+                        hi = std::strtol(p, &e, 10);
+                        if(e == p)
+                            break;
+                    }
+                    for(long i = lo; i <= hi; ++i)
+                        ids.push_back(static_cast<int>(i));
+                    if(',' != *e)
+                        break;
+                    p = e + 1;
+                }
+                return ids;
+            }
+
+            // The CPUs of each online NUMA node, in the order of the nodes, or
+            // nothing if the kernel does not describe them. Read once.
+            inline std::vector<std::vector<int>> const &numa_node_cpus()
+            {
+                static std::vector<std::vector<int>> const nodes = []
+                {
+                    std::vector<std::vector<int>> nodes;
+#if RANGES_NUMA_AFFINITY
+                    std::string const dir = "/sys/devices/system/node/";
+                    std::ifstream online(dir + "online");
+                    std::string list;
+                    if(!std::getline(online, list))
+                        return nodes;
+                    for(int node : detail::parse_sysfs_list(list))
+                    {
+                        std::ifstream cpulist(dir + "node" + std::to_string(node) + "/cpulist");
+                        std::vector<int> cpus;
+                        if(std::getline(cpulist, list))
+                            cpus = detail::parse_sysfs_list(list);
+                        // Memory-only nodes have no CPUs to run a chunk on.
+                        if(!cpus.empty())
+                            nodes.push_back(std::move(cpus));
+                    }
+#endif
+                    return nodes;
+                }();
+                return nodes;
+            }
+
+            // While alive, restricts the calling thread to the CPUs of the NUMA
+            // node of the k-th of chunks chunks, if the policy is pinned, and
+            // then gives it back the CPUs it had.
+            struct numa_pin
+            {
+#if RANGES_NUMA_AFFINITY
+            private:
+                cpu_set_t old_;
+                bool pinned_;
+            public:
+                numa_pin(parallel_policy const &policy, std::size_t k, std::size_t chunks)
+                  : pinned_(false)
+                {
+                    if(!policy.pinned())
+                        return;
+                    auto const &nodes = detail::numa_node_cpus();
+                    if(nodes.empty())
+                        return;
+                    cpu_set_t cpus;
+                    CPU_ZERO(&cpus);
+                    for(int cpu : nodes[k * nodes.size() / chunks])
+                        if(0 <= cpu && cpu < CPU_SETSIZE)
+                            CPU_SET(cpu, &cpus);
+                    pinned_ = 0 == sched_getaffinity(0, sizeof(old_), &old_) &&
+                        0 == sched_setaffinity(0, sizeof(cpus), &cpus);
+                }
+                ~numa_pin()
+                {
+                    if(pinned_)
+                        sched_setaffinity(0, sizeof(old_), &old_);
+                }
+#else
+                numa_pin(parallel_policy const &, std::size_t, std::size_t)
+                {}
+#endif
+                numa_pin(numa_pin const &) = delete;
+                numa_pin &operator=(numa_pin const &) = delete;
+            };
+
+            // Calls fun(k) for every k in [0, tasks), with the tasks split into
+            // contiguous runs over at most policy.concurrency() threads, one of
+            // which is the calling thread. Returns when all calls have. If any
+            // call throws, one of the exceptions is rethrown. Thread t of T
+            // runs on the NUMA node of chunk t of T, if the policy is pinned.
+            template<typename Fun>
+            void parallel_for(parallel_policy const &policy, std::size_t tasks, Fun &&fun)
+            {
+                std::size_t const threads =
+                    tasks < policy.concurrency() ? tasks : policy.concurrency();
+                if(threads <= 1)
+                {
+                    detail::numa_pin const pin(policy, 0, 1);
+                    for(std::size_t k = 0; k < tasks; ++k)
+                        fun(k);
+                    return;
+                }
+                std::exception_ptr error;
+                std::mutex error_mutex;
+                auto const run = [&](std::size_t t)
+                {
+                    try
+                    {
+                        detail::numa_pin const pin(policy, t, threads);
+                        auto const r = detail::static_chunk(tasks, threads, t);
+                        for(std::size_t k = r.first; k < r.second; ++k)
+                            fun(k);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if(!error)
+                            error = std::current_exception();
+                    }
+                };
+                std::vector<std::thread> workers;
+                workers.reserve(threads - 1);
+                std::size_t t = 1;
+                try
+                {
+                    for(; t < threads; ++t)
+                        workers.emplace_back(run, t);
+                }
+                catch(...)
+                {
+                    // Could not start a thread; do its share here.
+                    for(; t < threads; ++t)
+                        run(t);
+                }
+                run(0);
+                for(auto &w : workers)
+                    w.join();
+                if(error)
+                    std::rethrow_exception(error);
+            }
+
+            // Calls fun(lo, hi) for each of the chunks that parallel_chunks
+            // splits [0, n) into, concurrently.
+            template<typename D, typename Fun>
+            void parallel_for_chunks(parallel_policy const &policy, D n, Fun &&fun)
+            {
+                std::size_t const chunks = detail::parallel_chunks(policy, n);
+                detail::parallel_for(policy, chunks, [&](std::size_t k)
+                {
+                    auto const r = detail::static_chunk(n, chunks, k);
+                    fun(r.first, r.second);
+                });
+            }
+
+            // Calls partial(lo, hi) for each of the chunks that parallel_chunks
+            // splits [0, n) into, concurrently, and folds the results in the
+            // order of the chunks: combine(combine(p0, p1), p2), and so on.
+            template<typename D, typename Partial, typename Combine>
+            auto parallel_reduce(parallel_policy const &policy, D n, Partial &&partial,
+                Combine &&combine) -> decltype(partial(n, n))
+            {
+                std::size_t const chunks = detail::parallel_chunks(policy, n);
+                std::vector<decltype(partial(n, n))> partials(chunks);
+                detail::parallel_for(policy, chunks, [&](std::size_t k)
+                {
+                    auto const r = detail::static_chunk(n, chunks, k);
+                    partials[k] = partial(r.first, r.second);
+                });
+                auto result = std::move(partials[0]);
+                for(std::size_t k = 1; k < chunks; ++k)
+                    result = combine(std::move(result), std::move(partials[k]));
+                return result;
+            }
+
+            // The index of the first match in [0, n), or n if there is none,
+            // where find(lo, hi) returns that of the first match in [lo, hi),
+            // or hi. The range is cut into blocks dealt out to the threads in
+            // turn, so all of them sweep from the front. A match lowers a
+            // shared cut-off, and the blocks beyond it are then skipped, by
+            // every thread; the result does not depend on the number of
+            // threads. If a call to find throws, the other threads stop at
+            // their next block.
+            template<typename D, typename Find>
+            D parallel_find_first(parallel_policy const &policy, D n, Find &&find,
+                std::ptrdiff_t block)
+            {
+                std::size_t const threads = detail::parallel_chunks(policy, n);
+                if(threads <= 1)
+                    return find(D(0), n);
+                D const blocks = (n + static_cast<D>(block) - 1) / static_cast<D>(block);
+                std::atomic<D> cutoff(n);
+                auto const lower = [&](D i)
+                {
+                    D c = cutoff.load(std::memory_order_relaxed);
+                    while(i < c && !cutoff.compare_exchange_weak(c, i, std::memory_order_relaxed))
+                        ;
+                };
+                detail::parallel_for(policy, threads, [&](std::size_t t)
+                {
+                    try
+                    {
+                        for(D b = static_cast<D>(t); b < blocks; b += static_cast<D>(threads))
+                        {
+                            D const lo = b * static_cast<D>(block);
+                            if(lo >= cutoff.load(std::memory_order_relaxed))
+                                return;
+                            D const hi = (std::min)(lo + static_cast<D>(block), n);
+                            D const i = find(lo, hi);
+                            if(i != hi)
+                                return lower(i);
+                        }
+                    }
+                    catch(...)
+                    {
+                        cutoff.store(D(0), std::memory_order_relaxed);
+                        throw;
+                    }
+                });
+                return cutoff.load(std::memory_order_relaxed);
+            }
+        }
+        /// \endcond
+
+        /// \ingroup group-utility
+        /// \sa `parallel_policy`
+        namespace
+        {
+            constexpr auto&& par = static_const<parallel_policy>::value;
+        }
+
+        /// @}
+    }
+}
+
+#endif
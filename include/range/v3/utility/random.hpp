@@ -0,0 +1,241 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_RANDOM_HPP
+#define RANGES_V3_UTILITY_RANDOM_HPP
+
+#include <limits>
+#include <random>
+#include <cstdint>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Returns the high 64 bits of a * b, and stores the low 64 in lo.
+            inline std::uint64_t mul_64x64_128(std::uint64_t a, std::uint64_t b, std::uint64_t &lo)
+            {
+            #if defined(__SIZEOF_INT128__)
+                unsigned __int128 const m = static_cast<unsigned __int128>(a) * b;
+                lo = static_cast<std::uint64_t>(m);
+                return static_cast<std::uint64_t>(m >> 64);
+            #else
+                std::uint64_t const a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+                std::uint64_t const b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+                std::uint64_t const ll = a_lo * b_lo, lh = a_lo * b_hi;
+                std::uint64_t const hl = a_hi * b_lo, hh = a_hi * b_hi;
+                std::uint64_t const mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+                lo = (mid << 32) | (ll & 0xFFFFFFFFu);
+                return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+            #endif
+            }
+
+            // A small, fast generator with a 64-bit state that passes BigCrush.
+            // Used to derive independent, reproducible streams from one seed.
+            struct splitmix64
+            {
+                using result_type = std::uint64_t;
+                std::uint64_t state;
+                static constexpr std::uint64_t min()
+                {
+                    return 0;
+                }
+                static constexpr std::uint64_t max()
+                {
+                    return ~std::uint64_t(0);
+                }
+                std::uint64_t operator()()
+                {
+                    std::uint64_t z = (state += 0x9E3779B97F4A7C15u);
+                    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+                    z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+                    return z ^ (z >> 31);
+                }
+            };
+
+            template<typename Gen>
+            using random_words_kind = std::integral_constant<int,
+                Gen::min() != 0 ? 0 :
+                Gen::max() == std::numeric_limits<std::uint64_t>::max() ? 64 :
+                Gen::max() == std::numeric_limits<std::uint32_t>::max() ? 32 : 0>;
+
+            // Adapts any uniform random bit generator into a source of uniformly
+            // distributed 64-bit words, drawing whole words from generators that
+            // produce them.
+            template<typename Gen>
+            struct random_words
+            {
+            private:
+                Gen &gen_;
+                std::uint64_t next(std::integral_constant<int, 64>)
+                {
+                    return static_cast<std::uint64_t>(gen_());
+                }
+                std::uint64_t next(std::integral_constant<int, 32>)
+                {
+                    std::uint64_t const hi = static_cast<std::uint64_t>(gen_());
+                    return (hi << 32) | static_cast<std::uint64_t>(gen_());
+                }
+                std::uint64_t next(std::integral_constant<int, 0>)
+                {
+                    return std::uniform_int_distribution<std::uint64_t>{}(gen_);
+                }
+            public:
+                explicit random_words(Gen &gen)
+                  : gen_(gen)
+                {}
+                std::uint64_t operator()()
+                {
+                    return this->next(random_words_kind<Gen>());
+                }
+            };
+
+            // Lemire's nearly divisionless method: a uniform integer in [0, s),
+            // for s > 0, that costs one multiplication, and a division only in
+            // the rare case that the sample must be checked for rejection.
+            template<typename Words>
+            std::uint64_t bounded_random(Words &words, std::uint64_t s)
+            {
+                std::uint64_t lo;
+                std::uint64_t hi = detail::mul_64x64_128(words(), s, lo);
+                if(lo < s)
+                {
+                    std::uint64_t const t = (0 - s) % s;
+                    while(lo < t)
+                        hi = detail::mul_64x64_128(words(), s, lo);
+                }
+                return hi;
+            }
+
+            // Two independent uniform integers, in [0, s1) and [0, s2), from a
+            // single 64-bit word, for s1 * s2 <= 2^64: the word is treated as a
+            // fixed-point fraction and multiplied by s1 and then s2, keeping
+            // the integer part each time (Brackett-Rozinsky and Lemire).
+            template<typename Words>
+            void bounded_random_2(Words &words, std::uint64_t s1, std::uint64_t s2,
+                std::uint64_t &r1, std::uint64_t &r2)
+            {
+                std::uint64_t lo;
+                r1 = detail::mul_64x64_128(words(), s1, lo);
+                r2 = detail::mul_64x64_128(lo, s2, lo);
+                std::uint64_t const product = s1 * s2;
+                if(lo < product)
+                {
+                    std::uint64_t const t = (0 - product) % product;
+                    while(lo < t)
+                    {
+                        r1 = detail::mul_64x64_128(words(), s1, lo);
+                        r2 = detail::mul_64x64_128(lo, s2, lo);
+                    }
+                }
+            }
+
+            // Single random bits, 64 to a word
+            template<typename Words>
+            struct random_bits
+            {
+            private:
+                Words &words_;
+                std::uint64_t bits_;
+                int left_;
+            public:
+                explicit random_bits(Words &words)
+                  : words_(words), bits_(0), left_(0)
+                {}
+                bool operator()()
+                {
+                    if(0 == left_)
+                    {
+                        bits_ = words_();
+                        left_ = 64;
+                    }
+                    bool const b = bits_ & 1u;
+                    bits_ >>= 1;
+                    --left_;
+                    return b;
+                }
+            };
+
+            // The Philox4x32-10 block function of Salmon, Moraes, Dror and Shaw,
+            // "Parallel Random Numbers: As Easy as 1, 2, 3": a keyed bijection
+            // on 128-bit counters whose outputs pass BigCrush for any sequence
+            // of counters. Replaces ctr with the block for (ctr, key).
+            inline void philox4x32_10(std::uint32_t (&ctr)[4], std::uint32_t k0, std::uint32_t k1)
+            {
+                for(int round = 0; round < 10; ++round)
+                {
+                    std::uint64_t const p0 = std::uint64_t(0xD2511F53u) * ctr[0];
+                    std::uint64_t const p1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+                    std::uint32_t const c1 = ctr[1], c3 = ctr[3];
+                    ctr[0] = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+                    ctr[1] = static_cast<std::uint32_t>(p1);
+                    ctr[2] = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+                    ctr[3] = static_cast<std::uint32_t>(p0);
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+            }
+
+            // The stream of random 32-bit words for the element with the given
+            // index: the Philox blocks for counters (index, 0), (index, 1), ...
+            // under the key seed. Streams of different indices are independent,
+            // and any of them can be started in O(1).
+            struct philox_stream
+            {
+            private:
+                std::uint64_t seed_;
+                std::uint64_t index_;
+                std::uint64_t block_index_;
+                std::uint32_t block_[4];
+                int used_;
+            public:
+                using result_type = std::uint32_t;
+                static constexpr std::uint32_t min()
+                {
+                    return 0;
+                }
+                static constexpr std::uint32_t max()
+                {
+                    return ~std::uint32_t(0);
+                }
+                philox_stream(std::uint64_t seed, std::uint64_t index)
+                  : seed_(seed), index_(index), block_index_(0), block_{}, used_(4)
+                {}
+                std::uint32_t operator()()
+                {
+                    if(4 == used_)
+                    {
+                        block_[0] = static_cast<std::uint32_t>(index_);
+                        block_[1] = static_cast<std::uint32_t>(index_ >> 32);
+                        block_[2] = static_cast<std::uint32_t>(block_index_);
+                        block_[3] = static_cast<std::uint32_t>(block_index_ >> 32);
+                        ++block_index_;
+                        detail::philox4x32_10(block_, static_cast<std::uint32_t>(seed_),
+                            static_cast<std::uint32_t>(seed_ >> 32));
+                        used_ = 0;
+                    }
+                    return block_[used_++];
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,156 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CACHE1_HPP
+#define RANGES_V3_VIEW_CACHE1_HPP
+
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_adaptor.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// Reads each element of the adapted range once, the first time it is
+        /// dereferenced, and keeps it in the view until the iterator moves on.
+        /// Placed after an expensive `view::transform`, it keeps adaptors that
+        /// dereference an element more than once, such as `view::remove_if`,
+        /// from calling the function more than once per element. The view is
+        /// a read-only input range, and can only be iterated once and through a
+        /// non-const view. Its elements can be moved from, but not assigned to,
+        /// since they are copies.
+        template<typename Rng>
+        struct cache1_view
+          : range_adaptor<cache1_view<Rng>, Rng>
+        {
+        private:
+            friend range_access;
+            using value_ = range_value_t<Rng>;
+            optional<value_> cache_;
+
+            struct adaptor
+              : adaptor_base
+            {
+            private:
+                cache1_view *rng_;
+                value_ & fill(range_iterator_t<Rng> const &it) const
+                {
+                    auto &cache = rng_->cache_;
+                    if(!cache)
+                        cache = *it;
+                    return *cache;
+                }
+            public:
+                using single_pass = std::true_type;
+                adaptor() = default;
+                adaptor(cache1_view &rng)
+                  : rng_(&rng)
+                {}
+                value_ const & current(range_iterator_t<Rng> const &it) const
+                {
+                    return this->fill(it);
+                }
+                value_ && indirect_move(range_iterator_t<Rng> const &it) const
+                {
+                    return std::move(this->fill(it));
+                }
+                void next(range_iterator_t<Rng> &it) const
+                {
+                    ++it;
+                    rng_->cache_.reset();
+                }
+            };
+            adaptor begin_adaptor()
+            {
+                cache_.reset();
+                return {*this};
+            }
+            adaptor end_adaptor()
+            {
+                return {*this};
+            }
+        public:
+            cache1_view() = default;
+            cache1_view(cache1_view &&that)
+              : range_adaptor_t<cache1_view>(std::move(that))
+              , cache_{}
+            {}
+            cache1_view(cache1_view const &that)
+              : range_adaptor_t<cache1_view>(that)
+              , cache_{}
+            {}
+            explicit cache1_view(Rng rng)
+              : range_adaptor_t<cache1_view>{std::move(rng)}
+              , cache_{}
+            {}
+            cache1_view& operator=(cache1_view &&that)
+            {
+                this->range_adaptor_t<cache1_view>::operator=(std::move(that));
+                cache_.reset();
+                return *this;
+            }
+            cache1_view& operator=(cache1_view const &that)
+            {
+                this->range_adaptor_t<cache1_view>::operator=(that);
+                cache_.reset();
+                return *this;
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            range_size_t<Rng> size() const
+            {
+                return ranges::size(this->base());
+            }
+        };
+
+        namespace view
+        {
+            struct cache1_fn
+            {
+                template<typename Rng>
+                cache1_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The object on which view::cache1 operates must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Movable<range_value_t<Rng>>(),
+                        "The value type of the range passed to view::cache1 must be a model "
+                        "of the Movable concept.");
+                    return cache1_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+            };
+
+            /// \relates cache1_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& cache1 = static_const<view<cache1_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
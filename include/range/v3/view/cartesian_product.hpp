@@ -0,0 +1,310 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CARTESIAN_PRODUCT_HPP
+#define RANGES_V3_VIEW_CARTESIAN_PRODUCT_HPP
+
+#include <array>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/empty.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/common_type.hpp>
+#include <range/v3/utility/common_tuple.hpp>
+#include <range/v3/utility/tuple_algorithm.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The tuples of one element of each of the adapted forward ranges, in
+        /// the order of nested loops over them, the last range innermost. When
+        /// all of them are sized and random-access, so is the product: the
+        /// i-th tuple is found from i by a mixed-radix decomposition, one digit
+        /// per range, so the product can be split into slices, and handed to
+        /// the parallel algorithms. Otherwise, the iterator steps the last
+        /// range, and restarts it and steps the one before when it runs out.
+        template<typename...Rngs>
+        struct cartesian_product_view
+          : range_facade<cartesian_product_view<Rngs...>>
+        {
+        private:
+            friend range_access;
+            static constexpr std::size_t N = sizeof...(Rngs);
+            std::tuple<Rngs...> rngs_;
+            using difference_type_ = common_type_t<range_difference_t<Rngs>...>;
+            using size_type_ = meta::eval<std::make_unsigned<difference_type_>>;
+
+            template<bool IsConst>
+            using base_t = meta::apply<meta::add_const_if_c<IsConst>, cartesian_product_view>;
+            template<bool IsConst>
+            using iterators_t =
+                std::tuple<range_iterator_t<meta::apply<meta::add_const_if_c<IsConst>, Rngs>>...>;
+            template<bool IsConst>
+            using reference_t =
+                common_tuple<range_reference_t<meta::apply<meta::add_const_if_c<IsConst>, Rngs>>...>;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                base_t<IsConst> *rng_;
+                iterators_t<IsConst> its_;
+
+                template<std::size_t...Is>
+                reference_t<IsConst> current_(index_sequence<Is...>) const
+                {
+                    return reference_t<IsConst>{*std::get<Is>(its_)...};
+                }
+                void next_(meta::size_t<0>)
+                {
+                    ++std::get<0>(its_);
+                }
+                template<std::size_t K>
+                void next_(meta::size_t<K>)
+                {
+                    auto &rng = std::get<K>(rng_->rngs_);
+                    auto &it = std::get<K>(its_);
+                    if(++it == ranges::end(rng))
+                    {
+                        it = ranges::begin(rng);
+                        this->next_(meta::size_t<K - 1>{});
+                    }
+                }
+            public:
+                using value_type = std::tuple<range_value_t<Rngs>...>;
+                cursor() = default;
+                explicit cursor(base_t<IsConst> &rng)
+                  : rng_(&rng), its_(tuple_transform(rng.rngs_, begin))
+                {
+                    // The product of an empty range with anything is empty.
+                    if(!tuple_foldl(tuple_transform(rng.rngs_, ranges::empty), false,
+                        [](bool a, bool b) { return a || b; }))
+                        return;
+                    auto &first = std::get<0>(rng.rngs_);
+                    std::get<0>(its_) = ranges::next(ranges::begin(first), ranges::end(first));
+                }
+                reference_t<IsConst> current() const
+                {
+                    return this->current_(make_index_sequence<N>{});
+                }
+                void next()
+                {
+                    this->next_(meta::size_t<N - 1>{});
+                }
+                bool done() const
+                {
+                    return std::get<0>(its_) == ranges::end(std::get<0>(rng_->rngs_));
+                }
+                bool equal(cursor const &that) const
+                {
+                    return its_ == that.its_;
+                }
+            };
+
+            template<typename Tup, std::size_t...Is>
+            static std::array<difference_type_, N> sizes_of_(Tup &rngs, index_sequence<Is...>)
+            {
+                return {{static_cast<difference_type_>(ranges::size(std::get<Is>(rngs)))...}};
+            }
+
+            template<bool IsConst>
+            struct indexed_cursor
+            {
+            private:
+                iterators_t<IsConst> begins_;
+                std::array<difference_type_, N> sizes_;
+                // The digits of index_, in the radices of sizes_
+                std::array<difference_type_, N> digits_;
+                difference_type_ index_;
+
+                template<std::size_t...Is>
+                reference_t<IsConst> current_(index_sequence<Is...>) const
+                {
+                    return reference_t<IsConst>{*(std::get<Is>(begins_) + digits_[Is])...};
+                }
+                void set_digits()
+                {
+                    auto i = index_;
+                    for(std::size_t k = N; k-- != 0;)
+                    {
+                        digits_[k] = i % sizes_[k];
+                        i /= sizes_[k];
+                    }
+                }
+            public:
+                using value_type = std::tuple<range_value_t<Rngs>...>;
+                using difference_type = difference_type_;
+                indexed_cursor() = default;
+                indexed_cursor(base_t<IsConst> &rng, difference_type_ index)
+                  : begins_(tuple_transform(rng.rngs_, begin))
+                  , sizes_(cartesian_product_view::sizes_of_(rng.rngs_, make_index_sequence<N>{}))
+                  , digits_{}, index_(index)
+                {
+                    if(0 != index_)
+                        this->set_digits();
+                }
+                reference_t<IsConst> current() const
+                {
+                    return this->current_(make_index_sequence<N>{});
+                }
+                void next()
+                {
+                    ++index_;
+                    for(std::size_t k = N; k-- != 0;)
+                    {
+                        if(++digits_[k] != sizes_[k])
+                            return;
+                        digits_[k] = 0;
+                    }
+                }
+                void prev()
+                {
+                    --index_;
+                    for(std::size_t k = N; k-- != 0;)
+                    {
+                        if(digits_[k]-- != 0)
+                            return;
+                        digits_[k] = sizes_[k] - 1;
+                    }
+                }
+                void advance(difference_type_ n)
+                {
+                    // An empty product has a zero radix, and no digits.
+                    if(0 == n)
+                        return;
+                    index_ += n;
+                    this->set_digits();
+                }
+                bool equal(indexed_cursor const &that) const
+                {
+                    return index_ == that.index_;
+                }
+                difference_type_ distance_to(indexed_cursor const &that) const
+                {
+                    return that.index_ - index_;
+                }
+            };
+
+            using are_indexed_t =
+                meta::and_c<((bool) RandomAccessIterable<Rngs>() && (bool) SizedIterable<Rngs>())...>;
+            template<bool IsConst>
+            using cursor_t = meta::if_<are_indexed_t, indexed_cursor<IsConst>, cursor<IsConst>>;
+            template<bool IsConst>
+            using end_cursor_t = meta::if_<are_indexed_t, indexed_cursor<IsConst>, default_sentinel>;
+
+            template<bool IsConst, typename Self>
+            static cursor_t<IsConst> begin_cursor_(Self &self, std::true_type)
+            {
+                return {self, 0};
+            }
+            template<bool IsConst, typename Self>
+            static cursor_t<IsConst> begin_cursor_(Self &self, std::false_type)
+            {
+                return cursor<IsConst>{self};
+            }
+            template<bool IsConst, typename Self>
+            static end_cursor_t<IsConst> end_cursor_(Self &self, std::true_type)
+            {
+                return {self, static_cast<difference_type_>(self.size())};
+            }
+            template<bool IsConst, typename Self>
+            static end_cursor_t<IsConst> end_cursor_(Self &, std::false_type)
+            {
+                return {};
+            }
+            cursor_t<false> begin_cursor()
+            {
+                return cartesian_product_view::begin_cursor_<false>(*this, are_indexed_t{});
+            }
+            end_cursor_t<false> end_cursor()
+            {
+                return cartesian_product_view::end_cursor_<false>(*this, are_indexed_t{});
+            }
+            CONCEPT_REQUIRES(meta::and_c<(bool) ForwardIterable<Rngs const>()...>::value)
+            cursor_t<true> begin_cursor() const
+            {
+                return cartesian_product_view::begin_cursor_<true>(*this, are_indexed_t{});
+            }
+            CONCEPT_REQUIRES(meta::and_c<(bool) ForwardIterable<Rngs const>()...>::value)
+            end_cursor_t<true> end_cursor() const
+            {
+                return cartesian_product_view::end_cursor_<true>(*this, are_indexed_t{});
+            }
+        public:
+            cartesian_product_view() = default;
+            explicit cartesian_product_view(Rngs ...rngs)
+              : rngs_{std::move(rngs)...}
+            {}
+            CONCEPT_REQUIRES(meta::and_c<(bool) SizedIterable<Rngs>()...>::value)
+            size_type_ size() const
+            {
+                return tuple_foldl(
+                    tuple_transform(rngs_, ranges::size),
+                    size_type_{1},
+                    [](size_type_ a, size_type_ b) { return a * b; });
+            }
+        };
+
+        namespace view
+        {
+            struct cartesian_product_fn
+            {
+                template<typename...Rngs,
+                    CONCEPT_REQUIRES_(0 != sizeof...(Rngs) &&
+                        meta::and_<ForwardIterable<Rngs>...>())>
+                cartesian_product_view<all_t<Rngs>...> operator()(Rngs &&... rngs) const
+                {
+                    return cartesian_product_view<all_t<Rngs>...>{
+                        all(std::forward<Rngs>(rngs))...};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename...Rngs,
+                    CONCEPT_REQUIRES_(!(0 != sizeof...(Rngs) &&
+                        meta::and_<ForwardIterable<Rngs>...>()))>
+                void operator()(Rngs &&...) const
+                {
+                    CONCEPT_ASSERT_MSG(0 != sizeof...(Rngs),
+                        "view::cartesian_product must be passed at least one range.");
+                    CONCEPT_ASSERT_MSG(meta::and_<ForwardIterable<Rngs>...>(),
+                        "All of the objects passed to view::cartesian_product must model the "
+                        "ForwardIterable concept.");
+                }
+            #endif
+            };
+
+            /// \relates cartesian_product_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& cartesian_product = static_const<cartesian_product_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
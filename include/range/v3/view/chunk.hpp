@@ -0,0 +1,376 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CHUNK_HPP
+#define RANGES_V3_VIEW_CHUNK_HPP
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, bool IsForward = ForwardIterable<Rng>()>
+            struct chunk_view_
+              : range_facade<chunk_view<Rng>, is_infinite<Rng>::value>
+            {
+            private:
+                friend range_access;
+                using difference_type_ = range_difference_t<Rng>;
+                Rng rng_;
+                difference_type_ n_;
+
+                // Over a sized random-access range, the i-th chunk is found in O(1)
+                // from i, and the chunks form a random-access range.
+                using indexed_t = meta::and_<RandomAccessIterable<Rng>, SizedIterable<Rng>>;
+
+                template<bool IsConst>
+                struct indexed_cursor
+                {
+                private:
+                    using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                    using iterator_t = range_iterator_t<base_t>;
+                    iterator_t first_;
+                    difference_type_ size_;
+                    difference_type_ n_;
+                    difference_type_ index_;
+                public:
+                    indexed_cursor() = default;
+                    indexed_cursor(base_t &rng, difference_type_ n, end_tag)
+                      : indexed_cursor(rng, n, begin_tag{})
+                    {
+                        index_ = size_ / n_ + (size_ % n_ != 0);
+                    }
+                    indexed_cursor(base_t &rng, difference_type_ n, begin_tag)
+                      : first_(ranges::begin(rng))
+                      , size_(static_cast<difference_type_>(ranges::size(rng)))
+                      , n_(n), index_(0)
+                    {}
+                    sized_range<iterator_t> current() const
+                    {
+                        auto const lo = index_ * n_;
+                        auto const hi = n_ < size_ - lo ? lo + n_ : size_;
+                        return {first_ + lo, first_ + hi, static_cast<iterator_size_t<iterator_t>>(hi - lo)};
+                    }
+                    void next()
+                    {
+                        ++index_;
+                    }
+                    void prev()
+                    {
+                        --index_;
+                    }
+                    void advance(difference_type_ n)
+                    {
+                        index_ += n;
+                    }
+                    bool equal(indexed_cursor const &that) const
+                    {
+                        return index_ == that.index_;
+                    }
+                    difference_type_ distance_to(indexed_cursor const &that) const
+                    {
+                        return that.index_ - index_;
+                    }
+                };
+
+                // Otherwise, the end of each chunk is found once, as the cursor
+                // reaches it.
+                template<bool IsConst>
+                struct cursor
+                {
+                private:
+                    using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                    using iterator_t = range_iterator_t<base_t>;
+                    iterator_t cur_;
+                    iterator_t chunk_end_;
+                    difference_type_ chunk_size_;
+                    range_sentinel_t<base_t> last_;
+                    difference_type_ n_;
+
+                    void find_chunk_end()
+                    {
+                        chunk_end_ = cur_;
+                        chunk_size_ = n_ - ranges::advance(chunk_end_, n_, last_);
+                    }
+                public:
+                    cursor() = default;
+                    cursor(base_t &rng, difference_type_ n, begin_tag)
+                      : cur_(ranges::begin(rng)), chunk_end_(cur_), chunk_size_(0)
+                      , last_(ranges::end(rng)), n_(n)
+                    {
+                        this->find_chunk_end();
+                    }
+                    sized_range<iterator_t> current() const
+                    {
+                        return {cur_, chunk_end_, static_cast<iterator_size_t<iterator_t>>(chunk_size_)};
+                    }
+                    void next()
+                    {
+                        cur_ = chunk_end_;
+                        this->find_chunk_end();
+                    }
+                    bool done() const
+                    {
+                        return cur_ == last_;
+                    }
+                    bool equal(cursor const &that) const
+                    {
+                        return cur_ == that.cur_;
+                    }
+                };
+
+                template<bool IsConst>
+                using cursor_t = meta::if_<indexed_t, indexed_cursor<IsConst>, cursor<IsConst>>;
+                template<bool IsConst>
+                using end_cursor_t = meta::if_<indexed_t, indexed_cursor<IsConst>, default_sentinel>;
+
+                template<bool IsConst, typename Self>
+                static end_cursor_t<IsConst> end_cursor_(Self &self, std::true_type)
+                {
+                    return {self.rng_, self.n_, end_tag{}};
+                }
+                template<bool IsConst, typename Self>
+                static end_cursor_t<IsConst> end_cursor_(Self &, std::false_type)
+                {
+                    return {};
+                }
+                cursor_t<false> begin_cursor()
+                {
+                    return {rng_, n_, begin_tag{}};
+                }
+                end_cursor_t<false> end_cursor()
+                {
+                    return chunk_view_::end_cursor_<false>(*this, indexed_t{});
+                }
+                CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+                cursor_t<true> begin_cursor() const
+                {
+                    return {rng_, n_, begin_tag{}};
+                }
+                CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+                end_cursor_t<true> end_cursor() const
+                {
+                    return chunk_view_::end_cursor_<true>(*this, indexed_t{});
+                }
+            public:
+                chunk_view_() = default;
+                chunk_view_(Rng rng, difference_type_ n)
+                  : rng_(std::move(rng)), n_(n)
+                {
+                    RANGES_ASSERT(0 < n_);
+                }
+                CONCEPT_REQUIRES(SizedIterable<Rng>())
+                range_size_t<Rng> size() const
+                {
+                    auto const n = static_cast<range_size_t<Rng>>(n_);
+                    auto const m = ranges::size(rng_);
+                    return m / n + (m % n != 0);
+                }
+                Rng & base()
+                {
+                    return rng_;
+                }
+                Rng const & base() const
+                {
+                    return rng_;
+                }
+            };
+
+            // An input range is read a chunk at a time into a buffer in the view,
+            // and each chunk is a range of the buffer's elements, which are
+            // contiguous, and which the chunk's reader is free to move from.
+            template<typename Rng>
+            struct chunk_view_<Rng, false>
+              : range_facade<chunk_view<Rng>, is_infinite<Rng>::value>
+            {
+            private:
+                friend range_access;
+                using difference_type_ = range_difference_t<Rng>;
+                using value_type_ = range_value_t<Rng>;
+                Rng rng_;
+                difference_type_ n_;
+                std::vector<value_type_> buffer_;
+
+                struct cursor
+                {
+                private:
+                    chunk_view_ *rng_;
+                    range_iterator_t<Rng> it_;
+                public:
+                    using single_pass = std::true_type;
+                    cursor() = default;
+                    explicit cursor(chunk_view_ &rng)
+                      : rng_(&rng), it_(ranges::begin(rng.rng_))
+                    {
+                        rng_->buffer_.reserve(static_cast<std::size_t>(rng_->n_));
+                        this->next();
+                    }
+                    range<value_type_ *> current() const
+                    {
+                        auto &buf = rng_->buffer_;
+                        return {buf.data(), buf.data() + buf.size()};
+                    }
+                    void next()
+                    {
+                        auto &buf = rng_->buffer_;
+                        auto const last = ranges::end(rng_->rng_);
+                        buf.clear();
+                        for(difference_type_ i = 0; i < rng_->n_ && it_ != last; ++i, ++it_)
+                            buf.emplace_back(*it_);
+                    }
+                    bool done() const
+                    {
+                        return rng_->buffer_.empty();
+                    }
+                };
+                cursor begin_cursor()
+                {
+                    return cursor{*this};
+                }
+            public:
+                chunk_view_() = default;
+                chunk_view_(Rng rng, difference_type_ n)
+                  : rng_(std::move(rng)), n_(n), buffer_{}
+                {
+                    RANGES_ASSERT(0 < n_);
+                }
+                chunk_view_(chunk_view_ &&that)
+                  : rng_(std::move(that).rng_), n_(that.n_), buffer_{}
+                {}
+                chunk_view_(chunk_view_ const &that)
+                  : rng_(that.rng_), n_(that.n_), buffer_{}
+                {}
+                chunk_view_& operator=(chunk_view_ &&that)
+                {
+                    rng_ = std::move(that).rng_;
+                    n_ = that.n_;
+                    buffer_.clear();
+                    return *this;
+                }
+                chunk_view_& operator=(chunk_view_ const &that)
+                {
+                    rng_ = that.rng_;
+                    n_ = that.n_;
+                    buffer_.clear();
+                    return *this;
+                }
+                CONCEPT_REQUIRES(SizedIterable<Rng>())
+                range_size_t<Rng> size() const
+                {
+                    auto const n = static_cast<range_size_t<Rng>>(n_);
+                    auto const m = ranges::size(rng_);
+                    return m / n + (m % n != 0);
+                }
+                Rng & base()
+                {
+                    return rng_;
+                }
+                Rng const & base() const
+                {
+                    return rng_;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of the adapted range in consecutive chunks of \c n,
+        /// the last of which may be shorter. Each chunk of a forward range is a
+        /// `sized_range` of its iterators; over a sized random-access range,
+        /// the chunks form a sized random-access range, and the i-th is found
+        /// in O(1). An input range is read a chunk at a time into a buffer,
+        /// and each chunk is a range of pointers into the buffer.
+        template<typename Rng>
+        struct chunk_view
+          : detail::chunk_view_<Rng>
+        {
+            using detail::chunk_view_<Rng>::chunk_view_;
+        };
+
+        namespace view
+        {
+            struct chunk_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(chunk_fn chunk, Int n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(chunk, std::placeholders::_1, n))
+                )
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Int, CONCEPT_REQUIRES_(!Integral<Int>())>
+                static detail::null_pipe bind(chunk_fn, Int)
+                {
+                    CONCEPT_ASSERT_MSG(Integral<Int>(),
+                        "The object passed to view::chunk must be a model of the Integral "
+                        "concept.");
+                    return {};
+                }
+            #endif
+            public:
+                template<typename Rng, CONCEPT_REQUIRES_(InputIterable<Rng>())>
+                chunk_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    return {all(std::forward<Rng>(rng)), n};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T,
+                    CONCEPT_REQUIRES_(!InputIterable<Rng>())>
+                void operator()(Rng &&, T) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The object to be operated on by view::chunk should be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Integral<T>(),
+                        "The second argument to view::chunk must be a model of the Integral "
+                        "concept.");
+                }
+            #endif
+            };
+
+            /// \relates chunk_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& chunk = static_const<view<chunk_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -45,6 +45,7 @@ namespace ranges
         {
         private:
             friend range_access;
+            friend struct view::drop_fn;
             using difference_type_ = range_difference_t<Rng>;
             Rng rng_;
             difference_type_ n_;
@@ -129,6 +130,21 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_drop_view_
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_drop_view_<drop_view<Rng>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct drop_fn
@@ -164,14 +180,28 @@ namespace ranges
                 {
                     return {next(begin(rng), n), end(rng)};
                 }
+                // Dropping \c n elements and then \c m more drops `n + m`.
+                template<typename Rng>
+                static drop_view<Rng> fuse_(drop_view<Rng> rng, range_difference_t<Rng> n)
+                {
+                    return {std::move(rng.rng_), rng.n_ + n};
+                }
             public:
                 template<typename Rng,
-                    CONCEPT_REQUIRES_(InputIterable<Rng>())>
+                    CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                        !detail::is_drop_view_<uncvref_t<Rng>>::value)>
                 auto operator()(Rng && rng, range_difference_t<Rng> n) const
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
                     drop_fn::invoke_(std::forward<Rng>(rng), n, iterable_concept<Rng>{})
                 )
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(detail::is_drop_view_<uncvref_t<Rng>>::value)>
+                auto operator()(Rng && rng, range_difference_t<Rng> n) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    drop_fn::fuse_(std::forward<Rng>(rng), n)
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
                     CONCEPT_REQUIRES_(!(InputIterable<Rng>() && Integral<T>()))>
@@ -21,7 +21,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_interface.hpp>
 #include <range/v3/utility/meta.hpp>
-#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/cache.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -35,22 +35,26 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
-        template<typename Rng, typename Pred>
+        /// The view finds its begin the first time it is asked for it, and
+        /// keeps it, as `remove_if_view` does, and with the same caching
+        /// policies.
+        template<typename Rng, typename Pred, typename Cache = single_threaded_cache>
         struct drop_while_view
-          : range_interface<drop_while_view<Rng, Pred>, is_infinite<Rng>::value>
+          : range_interface<drop_while_view<Rng, Pred, Cache>, is_infinite<Rng>::value>
        {
         private:
             friend range_access;
             using difference_type_ = range_difference_t<Rng>;
             Rng rng_;
             semiregular_t<invokable_t<Pred>> pred_;
-            optional<range_iterator_t<Rng>> begin_;
+            detail::lazy_cache<range_iterator_t<Rng>, Cache> begin_;
 
             range_iterator_t<Rng> get_begin_()
             {
-                if(!begin_)
-                    begin_ = find_if_not(rng_, std::ref(pred_));
-                return *begin_;
+                return begin_.get([this]
+                {
+                    return find_if_not(rng_, std::ref(pred_));
+                });
             }
         public:
             drop_while_view() = default;
@@ -107,6 +111,14 @@ namespace ranges
                 (
                     make_pipeable(std::bind(drop_while, std::placeholders::_1, protect(std::move(pred))))
                 )
+                template<typename Pred, typename Cache,
+                    CONCEPT_REQUIRES_(detail::is_cache_policy<Cache>())>
+                static auto bind(drop_while_fn drop_while, Pred pred, Cache cache)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(drop_while, std::placeholders::_1, protect(std::move(pred)),
+                        cache))
+                )
             public:
                 template<typename Rng, typename Pred>
                 using Concept = meta::and_<
@@ -120,6 +132,16 @@ namespace ranges
                 {
                     return {all(std::forward<Rng>(rng)), std::move(pred)};
                 }
+                /// With the given caching policy, \c single_threaded_cache or \c
+                /// shared_cache
+                template<typename Rng, typename Pred, typename Cache,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        detail::is_cache_policy<Cache>())>
+                drop_while_view<all_t<Rng>, Pred, Cache>
+                operator()(Rng && rng, Pred pred, Cache) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(pred)};
+                }
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Pred,
                     CONCEPT_REQUIRES_(!Concept<Rng, Pred>())>
@@ -29,12 +29,12 @@ namespace ranges
             struct filter_fn
             {
                 template<typename Rng, typename Pred>
-                remove_if_view<all_t<Rng>, logical_negate<Pred>>
-                operator()(Rng && rng, Pred pred) const
+                auto operator()(Rng && rng, Pred pred) const ->
+                    decltype(remove_if_fn{}(std::forward<Rng>(rng), not_(std::move(pred))))
                 {
                     CONCEPT_ASSERT(Iterable<Rng>());
                     CONCEPT_ASSERT(IndirectInvokablePredicate<Pred, range_iterator_t<Rng>>());
-                    return {all(std::forward<Rng>(rng)), not_(std::move(pred))};
+                    return remove_if_fn{}(std::forward<Rng>(rng), not_(std::move(pred)));
                 }
                 template<typename Pred>
                 auto operator()(Pred pred) const ->
@@ -15,16 +15,24 @@
 #define RANGES_V3_VIEW_FOR_EACH_HPP
 
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/range_adaptor.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/generate_n.hpp>
-#include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -33,13 +41,196 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+
+        /// A range of one element if it is engaged, and of none otherwise;
+        /// the result of `yield_if`.
+        template<typename Val>
+        struct maybe_view
+          : range_facade<maybe_view<Val>>
+        {
+        private:
+            friend struct range_access;
+            Val value_;
+            bool engaged_;
+            struct cursor
+            {
+            private:
+                Val value_;
+                bool done_;
+            public:
+                cursor() = default;
+                cursor(Val value, bool done)
+                  : value_(std::move(value)), done_(done)
+                {}
+                Val current() const
+                {
+                    return value_;
+                }
+                bool done() const
+                {
+                    return done_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return done_ == that.done_;
+                }
+                void next()
+                {
+                    done_ = true;
+                }
+                void prev()
+                {
+                    done_ = false;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    n += done_;
+                    RANGES_ASSERT(n == 0 || n == 1);
+                    done_ = n != 0;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.done_ - done_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {value_, !engaged_};
+            }
+        public:
+            maybe_view() = default;
+            maybe_view(bool engaged, Val value)
+              : value_(std::move(value)), engaged_(engaged)
+            {}
+            std::size_t size() const
+            {
+                return engaged_ ? 1u : 0u;
+            }
+        };
+
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_maybe_view_
+              : std::false_type
+            {};
+
+            template<typename Val>
+            struct is_maybe_view_<single_view<Val>>
+              : std::true_type
+            {};
+
+            template<typename Val>
+            struct is_maybe_view_<maybe_view<Val>>
+              : std::true_type
+            {};
+
+            template<typename Rng, typename F>
+            using for_each_result_t =
+                decay_t<concepts::Invokable::result_t<F, range_reference_t<Rng>>>;
+
+            // When the function returns a range of at most one element, as
+            // `yield` and `yield_if` do, the view is a filter and a transform
+            // in one: each iterator keeps the element of the last range that
+            // was not empty, rather than going through a join.
+            template<typename Rng, typename F>
+            struct for_each_maybe_view_
+              : range_adaptor<for_each_maybe_view_<Rng, F>, Rng>
+            {
+            private:
+                friend range_access;
+                using element_ = range_value_t<for_each_result_t<Rng, F>>;
+                semiregular_t<invokable_t<F>> fun_;
+
+                struct adaptor
+                  : adaptor_base
+                {
+                private:
+                    for_each_maybe_view_ *rng_;
+                    optional<element_> value_;
+                    using adaptor_base::advance;
+                    using adaptor_base::prev;
+                    void satisfy(range_iterator_t<Rng> &it)
+                    {
+                        auto &&fun = rng_->fun_;
+                        auto const last = ranges::end(rng_->mutable_base());
+                        for(; it != last; ++it)
+                        {
+                            auto &&maybe = fun(*it);
+                            auto jt = ranges::begin(maybe);
+                            if(jt != ranges::end(maybe))
+                            {
+                                value_ = iter_move(jt);
+                                return;
+                            }
+                        }
+                    }
+                public:
+                    adaptor() = default;
+                    adaptor(for_each_maybe_view_ &rng)
+                      : rng_(&rng), value_{}
+                    {}
+                    range_iterator_t<Rng> begin(for_each_maybe_view_ &rng)
+                    {
+                        auto it = ranges::begin(rng.mutable_base());
+                        this->satisfy(it);
+                        return it;
+                    }
+                    element_ current(range_iterator_t<Rng> const &) const
+                    {
+                        return *value_;
+                    }
+                    void next(range_iterator_t<Rng> &it)
+                    {
+                        this->satisfy(++it);
+                    }
+                };
+                adaptor begin_adaptor()
+                {
+                    return {*this};
+                }
+                adaptor end_adaptor()
+                {
+                    return {*this};
+                }
+            public:
+                for_each_maybe_view_() = default;
+                for_each_maybe_view_(Rng rng, F f)
+                  : range_adaptor_t<for_each_maybe_view_>{std::move(rng)}
+                  , fun_(invokable(std::move(f)))
+                {}
+            };
+
+            template<typename Rng, typename F>
+            using for_each_view_base_t =
+                meta::if_<is_maybe_view_<for_each_result_t<Rng, F>>,
+                    for_each_maybe_view_<Rng, F>,
+                    join_view<transform_view<Rng, F>>>;
+        }
+        /// \endcond
+
+        /// The concatenation of the ranges that the function returns for the
+        /// elements of the adapted range. If the function returns the result
+        /// of `yield` or `yield_if`, the view skips the elements for which it
+        /// yields nothing, and produces the others' values directly.
         template<typename Rng, typename F>
         struct for_each_view
-          : join_view<transform_view<Rng, F>>
+          : detail::for_each_view_base_t<Rng, F>
         {
+        private:
+            using base_t = detail::for_each_view_base_t<Rng, F>;
+            for_each_view(Rng rng, F f, std::true_type)
+              : base_t{std::move(rng), std::move(f)}
+            {}
+            for_each_view(Rng rng, F f, std::false_type)
+              : base_t{{std::move(rng), std::move(f)}}
+            {}
+        public:
             for_each_view() = default;
             for_each_view(Rng rng, F f)
-              : join_view<transform_view<Rng, F>>{{std::move(rng), std::move(f)}}
+              : for_each_view{std::move(rng), std::move(f),
+                    detail::is_maybe_view_<detail::for_each_result_t<Rng, F>>{}}
             {}
         };
 
@@ -131,9 +322,9 @@ namespace ranges
         struct yield_if_fn
         {
             template<typename V>
-            repeat_n_view<V> operator()(bool b, V v) const
+            maybe_view<V> operator()(bool b, V v) const
             {
-                return view::repeat_n(std::move(v), b ? 1 : 0);
+                return {b, std::move(v)};
             }
         };
 
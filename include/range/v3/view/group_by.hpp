@@ -26,6 +26,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/take_while.hpp>
@@ -105,6 +106,124 @@ namespace ranges
             {}
         };
 
+        /// Unlike the groups of a `group_by_view`, each group is found as soon
+        /// as the cursor reaches it, so that the predicate is evaluated once per
+        /// element, and is yielded as a `sized_range`. Elements are grouped with
+        /// the first element of their group, and the predicate must hold for a
+        /// prefix of the rest of the range only (as it does for a range sorted by
+        /// the key the predicate compares). Over sized random-access ranges, the
+        /// end of each group is found by galloping in O(log N) steps, where N is
+        /// the size of the group. Because a group is found eagerly, `begin()`
+        /// does not return if the first group is infinite.
+        template<typename Rng, typename Fun>
+        struct group_by_sorted_view
+          : range_facade<group_by_sorted_view<Rng, Fun>>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            semiregular_t<invokable_t<Fun>> fun_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access; friend group_by_sorted_view;
+                using gallop_t = meta::and_<
+                    RandomAccessIterator<range_iterator_t<Rng>>,
+                    SizedIteratorRange<range_iterator_t<Rng>, range_sentinel_t<Rng>>>;
+                range_iterator_t<Rng> cur_;
+                range_iterator_t<Rng> group_end_;
+                iterator_size_t<range_iterator_t<Rng>> group_size_;
+                range_sentinel_t<Rng> last_;
+                semiregular_ref_or_val_t<invokable_t<Fun>, IsConst> fun_;
+
+                void find_group_end(std::false_type)
+                {
+                    group_end_ = cur_;
+                    group_size_ = 0;
+                    if(cur_ == last_)
+                        return;
+                    auto &&first = *cur_;
+                    do
+                    {
+                        ++group_end_;
+                        ++group_size_;
+                    } while(group_end_ != last_ && fun_(first, *group_end_));
+                }
+                void find_group_end(std::true_type)
+                {
+                    auto const n = distance(cur_, last_);
+                    if(0 == n)
+                    {
+                        group_end_ = cur_;
+                        group_size_ = 0;
+                        return;
+                    }
+                    // cur_[lo] is in the group, and cur_[hi] is not (or hi == n).
+                    auto &&first = *cur_;
+                    range_difference_t<Rng> lo = 0, step = 1;
+                    while(step < n - lo && fun_(first, *(cur_ + (lo + step))))
+                    {
+                        lo += step;
+                        step *= 2;
+                    }
+                    range_difference_t<Rng> hi = step < n - lo ? lo + step : n;
+                    while(hi - lo > 1)
+                    {
+                        auto const mid = lo + (hi - lo) / 2;
+                        if(fun_(first, *(cur_ + mid)))
+                            lo = mid;
+                        else
+                            hi = mid;
+                    }
+                    group_end_ = cur_ + (lo + 1);
+                    group_size_ = static_cast<iterator_size_t<range_iterator_t<Rng>>>(lo + 1);
+                }
+                sized_range<range_iterator_t<Rng>> current() const
+                {
+                    return {cur_, group_end_, group_size_};
+                }
+                void next()
+                {
+                    cur_ = group_end_;
+                    this->find_group_end(gallop_t());
+                }
+                bool done() const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+                cursor(semiregular_ref_or_val_t<invokable_t<Fun>, IsConst> fun, range_iterator_t<Rng> first,
+                    range_sentinel_t<Rng> last)
+                  : cur_(first), group_end_(first), group_size_(0), last_(last), fun_(fun)
+                {
+                    this->find_group_end(gallop_t());
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {fun_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Invokable<Fun const, range_common_reference_t<Rng>,
+                range_common_reference_t<Rng>>())
+            cursor<true> begin_cursor() const
+            {
+                return {fun_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            group_by_sorted_view() = default;
+            group_by_sorted_view(Rng rng, Fun fun)
+              : rng_(std::move(rng))
+              , fun_(std::move(fun))
+            {}
+        };
+
         namespace view
         {
             struct group_by_fn
@@ -154,6 +273,56 @@ namespace ranges
             {
                 constexpr auto&& group_by = static_const<view<group_by_fn>>::value;
             }
+
+            /// Like `view::group_by`, for ranges in which the elements of each group
+            /// are all the elements for which the predicate holds with its first
+            /// element, such as ranges sorted by the key the predicate compares.
+            /// Group boundaries in random-access ranges are found by galloping.
+            struct group_by_sorted_fn
+            {
+            private:
+                friend view_access;
+                template<typename Fun>
+                static auto bind(group_by_sorted_fn group_by_sorted, Fun fun)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(group_by_sorted, std::placeholders::_1,
+                        std::move(fun)))
+                )
+            public:
+                template<typename Rng, typename Fun>
+                using Concept = group_by_fn::Concept<Rng, Fun>;
+
+                template<typename Rng, typename Fun,
+                    CONCEPT_REQUIRES_(Concept<Rng, Fun>())>
+                group_by_sorted_view<all_t<Rng>, Fun> operator()(Rng && rng, Fun fun) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(fun)};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Fun,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Fun>())>
+                void operator()(Rng &&, Fun) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::group_by_sorted operates must be a model of "
+                        "the ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(IndirectInvokablePredicate<Fun, range_iterator_t<Rng>,
+                        range_iterator_t<Rng>>(),
+                        "The function passed to view::group_by_sorted must be callable with two "
+                        "arguments of the range's common reference type, and its return type "
+                        "must be convertible to bool.");
+                }
+            #endif
+            };
+
+            /// \relates group_by_sorted_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& group_by_sorted = static_const<view<group_by_sorted_fn>>::value;
+            }
         }
         /// @}
     }
@@ -31,41 +31,6 @@ namespace ranges
 {
     inline namespace v3
     {
-        namespace concepts
-        {
-            struct BidirectionalIncrementable
-              : refines<Incrementable>
-            {
-                template<typename T>
-                auto requires_(T t) -> decltype(
-                    concepts::valid_expr(
-                        concepts::has_type<T &>(--t),
-                        concepts::has_type<T>(t--)
-                    ));
-            };
-
-            struct RandomAccessIncrementable
-              : refines<BidirectionalIncrementable>
-            {
-                template<typename T>
-                auto requires_(T t) -> decltype(
-                    concepts::valid_expr(
-                        concepts::model_of<Integral>(t - t),
-                        concepts::has_type<T &>(t += (t - t)),
-                        concepts::has_type<T &>(t -= (t - t)),
-                        concepts::convertible_to<T>(t - (t - t)),
-                        concepts::convertible_to<T>(t + (t - t)),
-                        concepts::convertible_to<T>((t - t) + t)
-                    ));
-            };
-        }
-
-        template<typename T>
-        using BidirectionalIncrementable = concepts::models<concepts::BidirectionalIncrementable, T>;
-
-        template<typename T>
-        using RandomAccessIncrementable = concepts::models<concepts::RandomAccessIncrementable, T>;
-
         template<typename T>
         using incrementable_concept =
             concepts::most_refined<
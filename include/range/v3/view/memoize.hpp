@@ -0,0 +1,137 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MEMOIZE_HPP
+#define RANGES_V3_VIEW_MEMOIZE_HPP
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_adaptor.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// Reads each element of the adapted random-access range once, the
+        /// first time it is dereferenced, and keeps it in a buffer with a slot
+        /// for every element, so that reading it again, through any iterator,
+        /// reads the buffer. Placed after an expensive `view::transform`, it
+        /// makes algorithms that read elements more than once, such as
+        /// `view::reverse` or binary searches, call the function once per
+        /// element. Copies of the view share the buffer. Elements are read
+        /// through references to const, and the view is not safe to read from
+        /// several threads at once.
+        template<typename Rng>
+        struct memoize_view
+          : range_adaptor<memoize_view<Rng>, Rng>
+        {
+        private:
+            friend range_access;
+            using value_ = range_value_t<Rng>;
+            using buffer_ = std::vector<optional<value_>>;
+            std::shared_ptr<buffer_> memo_;
+
+            struct adaptor
+              : adaptor_base
+            {
+            private:
+                range_iterator_t<Rng> first_;
+                buffer_ *memo_;
+            public:
+                adaptor() = default;
+                adaptor(memoize_view &rng)
+                  : first_(ranges::begin(rng.mutable_base())), memo_(&rng.memo())
+                {}
+                value_ const & current(range_iterator_t<Rng> const &it) const
+                {
+                    auto &slot = (*memo_)[static_cast<std::size_t>(it - first_)];
+                    if(!slot)
+                        slot = *it;
+                    return *slot;
+                }
+                value_ const && indirect_move(range_iterator_t<Rng> const &it) const
+                {
+                    return std::move(this->current(it));
+                }
+            };
+            // A default-constructed view has no buffer until it is iterated.
+            buffer_ & memo()
+            {
+                if(!memo_)
+                    memo_ = std::make_shared<buffer_>(
+                        static_cast<std::size_t>(ranges::size(this->base())));
+                return *memo_;
+            }
+            adaptor begin_adaptor()
+            {
+                return {*this};
+            }
+            adaptor end_adaptor()
+            {
+                return {*this};
+            }
+        public:
+            memoize_view() = default;
+            explicit memoize_view(Rng rng)
+              : range_adaptor_t<memoize_view>{std::move(rng)}
+              , memo_(std::make_shared<buffer_>(
+                    static_cast<std::size_t>(ranges::size(this->base()))))
+            {}
+            range_size_t<Rng> size() const
+            {
+                return ranges::size(this->base());
+            }
+        };
+
+        namespace view
+        {
+            struct memoize_fn
+            {
+                template<typename Rng>
+                memoize_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessIterable<Rng>() && SizedIterable<Rng>(),
+                        "The object on which view::memoize operates must be a model of the "
+                        "RandomAccessIterable and SizedIterable concepts.");
+                    CONCEPT_ASSERT_MSG(Movable<range_value_t<Rng>>(),
+                        "The value type of the range passed to view::memoize must be a model "
+                        "of the Movable concept.");
+                    return memoize_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+            };
+
+            /// \relates memoize_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& memoize = static_const<view<memoize_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
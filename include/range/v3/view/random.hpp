@@ -0,0 +1,176 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_RANDOM_HPP
+#define RANGES_V3_VIEW_RANDOM_HPP
+
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The distribution of view::random without one: whole 64-bit words
+            struct random_words_distribution
+            {
+                using result_type = std::uint64_t;
+                template<typename Gen>
+                std::uint64_t operator()(Gen &gen) const
+                {
+                    std::uint64_t const lo = gen();
+                    return (static_cast<std::uint64_t>(gen()) << 32) | lo;
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// An infinite, random-access range whose element \c i is drawn from
+        /// \c Dist with a counter-based generator keyed by a seed and started
+        /// at \c i. Each element is computed in O(1) from its index alone, so
+        /// the same seed gives the same elements in any order of access and
+        /// from any number of threads.
+        template<typename Dist>
+        struct random_view
+          : range_facade<random_view<Dist>, true>
+        {
+        private:
+            friend range_access;
+            using value_type_ =
+                concepts::Function::result_t<Dist &, detail::philox_stream &>;
+            std::uint64_t seed_;
+            Dist dist_;
+
+            struct cursor
+            {
+            private:
+                random_view const *rng_;
+                std::ptrdiff_t index_;
+            public:
+                cursor() = default;
+                cursor(random_view const &rng, std::ptrdiff_t index)
+                  : rng_(&rng), index_(index)
+                {}
+                value_type_ current() const
+                {
+                    return rng_->at_(index_);
+                }
+                void next()
+                {
+                    ++index_;
+                }
+                constexpr bool done() const
+                {
+                    return false;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return index_ == that.index_;
+                }
+                void prev()
+                {
+                    --index_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    index_ += n;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.index_ - index_;
+                }
+            };
+            cursor begin_cursor() const
+            {
+                return {*this, 0};
+            }
+            value_type_ at_(std::ptrdiff_t index) const
+            {
+                RANGES_ASSERT(index >= 0);
+                detail::philox_stream gen{seed_, static_cast<std::uint64_t>(index)};
+                // Distributions may keep state between calls; start each element
+                // from a fresh copy so it depends on its index alone.
+                Dist dist = dist_;
+                return dist(gen);
+            }
+        public:
+            random_view() = default;
+            random_view(std::uint64_t seed, Dist dist)
+              : seed_(seed), dist_(std::move(dist))
+            {}
+        };
+
+        namespace view
+        {
+            struct random_fn
+            {
+                template<typename Dist>
+                using Concept = meta::and_<
+                    SemiRegular<Dist>,
+                    Function<Dist &, detail::philox_stream &>>;
+
+                /// Uniformly distributed 64-bit unsigned integers
+                random_view<detail::random_words_distribution> operator()(std::uint64_t seed) const
+                {
+                    return {seed, {}};
+                }
+                /// Values drawn from \c dist, which may be any of the standard
+                /// random number distributions, or another object callable with a
+                /// uniform random number generator
+                template<typename Dist,
+                    CONCEPT_REQUIRES_(Concept<Dist>())>
+                random_view<Dist> operator()(std::uint64_t seed, Dist dist) const
+                {
+                    return {seed, std::move(dist)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Dist,
+                    CONCEPT_REQUIRES_(!Concept<Dist>())>
+                void operator()(std::uint64_t, Dist) const
+                {
+                    CONCEPT_ASSERT_MSG(SemiRegular<Dist>(),
+                        "The distribution passed to view::random must be SemiRegular; that is, "
+                        "it needs to be default constructable, copy and move constructable, and "
+                        "destructable.");
+                    CONCEPT_ASSERT_MSG(Function<Dist &, detail::philox_stream &>(),
+                        "The distribution passed to view::random must be callable with a "
+                        "uniform random number generator, like the standard distributions.");
+                }
+            #endif
+            };
+
+            /// \relates random_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& random = static_const<random_fn>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -22,7 +22,7 @@
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/meta.hpp>
-#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/cache.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -35,14 +35,20 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
-        template<typename Rng, typename Pred>
+        /// The view finds its begin the first time it is asked for it, and
+        /// keeps it. With the default \c single_threaded_cache, it is kept in
+        /// a plain member; threads can share the view once it has been asked
+        /// for its begin. With a \c shared_cache, finding it is synchronized,
+        /// so threads can share the view from the start.
+        template<typename Rng, typename Pred, typename Cache = single_threaded_cache>
         struct remove_if_view
-          : range_adaptor<remove_if_view<Rng, Pred>, Rng>
+          : range_adaptor<remove_if_view<Rng, Pred, Cache>, Rng>
         {
         private:
             friend range_access;
+            friend struct view::remove_if_fn;
             semiregular_t<invokable_t<Pred>> pred_;
-            optional<range_iterator_t<Rng>> begin_;
+            detail::lazy_cache<range_iterator_t<Rng>, Cache> begin_;
 
             struct adaptor
               : adaptor_base
@@ -62,13 +68,12 @@ namespace ranges
                 {}
                 range_iterator_t<Rng> begin(remove_if_view &) const
                 {
-                    auto &beg = rng_->begin_;
-                    if(!beg)
+                    return rng_->begin_.get([this]
                     {
-                        beg = ranges::begin(rng_->mutable_base());
-                        this->satisfy(*beg);
-                    }
-                    return *beg;
+                        auto it = ranges::begin(rng_->mutable_base());
+                        this->satisfy(it);
+                        return it;
+                    });
                 }
                 void next(range_iterator_t<Rng> &it) const
                 {
@@ -124,6 +129,45 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Cache>
+            struct is_remove_if_view_
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Pred, typename Cache>
+            struct is_remove_if_view_<remove_if_view<Rng, Pred, Cache>, Cache>
+              : std::true_type
+            {};
+
+            // Satisfied by the elements that satisfy either predicate
+            template<typename Pred0, typename Pred1>
+            struct either_of_
+            {
+            private:
+                Pred0 pred0_;
+                Pred1 pred1_;
+            public:
+                either_of_() = default;
+                either_of_(Pred0 pred0, Pred1 pred1)
+                  : pred0_(std::move(pred0)), pred1_(std::move(pred1))
+                {}
+                template<typename T>
+                bool operator()(T && t)
+                {
+                    return pred0_(t) || pred1_(t);
+                }
+                template<typename T>
+                bool operator()(T && t) const
+                {
+                    return pred0_(t) || pred1_(t);
+                }
+            };
+        }
+        /// \endcond
+
         namespace view
         {
             struct remove_if_fn
@@ -136,6 +180,24 @@ namespace ranges
                 (
                     make_pipeable(std::bind(remove_if, std::placeholders::_1, protect(std::move(pred))))
                 )
+                template<typename Pred, typename Cache,
+                    CONCEPT_REQUIRES_(detail::is_cache_policy<Cache>())>
+                static auto bind(remove_if_fn remove_if, Pred pred, Cache cache)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(remove_if, std::placeholders::_1, protect(std::move(pred)),
+                        cache))
+                )
+                // Removing the elements that satisfy \c pred from those that do not
+                // satisfy \c first is removing those that satisfy either.
+                template<typename Rng, typename First, typename Cache, typename Pred>
+                static remove_if_view<Rng,
+                    detail::either_of_<invokable_t<First>, invokable_t<Pred>>, Cache>
+                fuse_(remove_if_view<Rng, First, Cache> rng, Pred pred)
+                {
+                    auto &first = static_cast<invokable_t<First> const &>(rng.pred_);
+                    return {std::move(rng.base()), {first, invokable(std::move(pred))}};
+                }
             public:
                 template<typename Rng, typename Pred>
                 using Concept = meta::and_<
@@ -143,12 +205,41 @@ namespace ranges
                     IndirectInvokablePredicate<Pred, range_iterator_t<Rng>>>;
 
                 template<typename Rng, typename Pred,
-                    CONCEPT_REQUIRES_(Concept<Rng, Pred>())>
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        !detail::is_remove_if_view_<uncvref_t<Rng>, single_threaded_cache>::value)>
                 remove_if_view<all_t<Rng>, Pred>
                 operator()(Rng && rng, Pred pred) const
                 {
                     return {all(std::forward<Rng>(rng)), std::move(pred)};
                 }
+                template<typename Rng, typename Pred,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        detail::is_remove_if_view_<uncvref_t<Rng>, single_threaded_cache>::value)>
+                auto operator()(Rng && rng, Pred pred) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    remove_if_fn::fuse_(std::forward<Rng>(rng), std::move(pred))
+                )
+                /// With the given caching policy, \c single_threaded_cache or \c
+                /// shared_cache
+                template<typename Rng, typename Pred, typename Cache,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        detail::is_cache_policy<Cache>() &&
+                        !detail::is_remove_if_view_<uncvref_t<Rng>, Cache>::value)>
+                remove_if_view<all_t<Rng>, Pred, Cache>
+                operator()(Rng && rng, Pred pred, Cache) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(pred)};
+                }
+                template<typename Rng, typename Pred, typename Cache,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        detail::is_cache_policy<Cache>() &&
+                        detail::is_remove_if_view_<uncvref_t<Rng>, Cache>::value)>
+                auto operator()(Rng && rng, Pred pred, Cache) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    remove_if_fn::fuse_(std::forward<Rng>(rng), std::move(pred))
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Pred,
                     CONCEPT_REQUIRES_(!Concept<Rng, Pred>())>
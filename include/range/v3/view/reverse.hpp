@@ -16,6 +16,7 @@
 
 #include <utility>
 #include <iterator>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
@@ -109,20 +110,52 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_reverse_view_
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_reverse_view_<reverse_view<Rng>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct reverse_fn
             {
+            private:
+                // Reversing a reversed range gives back the range.
+                template<typename Rng>
+                static Rng fuse_(reverse_view<Rng> rng)
+                {
+                    return std::move(rng.base());
+                }
+            public:
                 template<typename Rng>
                 using Concept = meta::and_<
                     BidirectionalIterable<Rng>,
                     BoundedIterable<Rng>>;
 
-                template<typename Rng, CONCEPT_REQUIRES_(Concept<Rng>())>
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(Concept<Rng>() &&
+                        !detail::is_reverse_view_<uncvref_t<Rng>>::value)>
                 reverse_view<all_t<Rng>> operator()(Rng && rng) const
                 {
                     return reverse_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
                 }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(detail::is_reverse_view_<uncvref_t<Rng>>::value)>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    reverse_fn::fuse_(std::forward<Rng>(rng))
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 // For error reporting
                 template<typename Rng, CONCEPT_REQUIRES_(!Concept<Rng>())>
@@ -0,0 +1,176 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SEARCH_ALL_HPP
+#define RANGES_V3_VIEW_SEARCH_ALL_HPP
+
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/searchers.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+        template<typename Rng, typename Srch>
+        struct search_all_view
+          : range_facade<search_all_view<Rng, Srch>>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            semiregular_t<Srch> searcher_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access;
+                friend search_all_view;
+                using searcher_ref_t = semiregular_ref_or_val_t<Srch, IsConst>;
+                std::pair<range_iterator_t<Rng>, range_iterator_t<Rng>> match_;
+                range_sentinel_t<Rng> last_;
+                searcher_ref_t searcher_;
+
+                range<range_iterator_t<Rng>> current() const
+                {
+                    return {match_.first, match_.second};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(match_.first != last_);
+                    // Matches may overlap, so resume one past the start of the last.
+                    match_ = searcher_(ranges::next(match_.first), last_);
+                }
+                bool done() const
+                {
+                    return match_.first == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return match_.first == that.match_.first;
+                }
+                cursor(searcher_ref_t searcher, range_iterator_t<Rng> first,
+                    range_sentinel_t<Rng> last)
+                  : match_{}, last_(last), searcher_(searcher)
+                {
+                    match_ = searcher_(std::move(first), last_);
+                }
+            public:
+                cursor() = default;
+            };
+            cursor<false> begin_cursor()
+            {
+                return {searcher_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Searcher<Srch const, range_iterator_t<Rng>, range_sentinel_t<Rng>>())
+            cursor<true> begin_cursor() const
+            {
+                return {searcher_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            search_all_view() = default;
+            search_all_view(Rng rng, Srch searcher)
+              : rng_(std::move(rng))
+              , searcher_(std::move(searcher))
+            {}
+        };
+
+        namespace view
+        {
+            struct search_all_fn
+            {
+            private:
+                friend view_access;
+                template<typename T>
+                static auto bind(search_all_fn search_all, T && t)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(search_all, std::placeholders::_1,
+                        bind_forward<T>(t)))
+                )
+            public:
+                template<typename Rng, typename Srch>
+                using SearcherConcept = meta::and_<
+                    ForwardIterable<Rng>,
+                    Searcher<Srch, range_iterator_t<Rng>, range_sentinel_t<Rng>>>;
+
+                template<typename Rng, typename Pat>
+                using PatternConcept = meta::and_<
+                    ForwardIterable<Rng>,
+                    InputIterable<Pat>,
+                    EqualityComparable<range_value_t<Rng>, range_value_t<Pat>>>;
+
+                /// Yields the bounds of every match of \c searcher in \c rng,
+                /// including overlapping ones.
+                template<typename Rng, typename Srch,
+                    CONCEPT_REQUIRES_(SearcherConcept<Rng, Srch>())>
+                search_all_view<all_t<Rng>, Srch> operator()(Rng && rng, Srch searcher) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(searcher)};
+                }
+                /// Yields the bounds of every occurrence of \c pattern in \c rng,
+                /// including overlapping ones, found with a `default_searcher`.
+                template<typename Rng, typename Pat,
+                    CONCEPT_REQUIRES_(PatternConcept<Rng, Pat>())>
+                search_all_view<all_t<Rng>, default_searcher<range_value_t<Pat>>>
+                operator()(Rng && rng, Pat && pattern) const
+                {
+                    return {all(std::forward<Rng>(rng)),
+                        default_searcher<range_value_t<Pat>>{std::forward<Pat>(pattern)}};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T,
+                    CONCEPT_REQUIRES_(!SearcherConcept<Rng, T>() && !PatternConcept<Rng, T>())>
+                void operator()(Rng &&, T &&) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::search_all operates must be a model of the "
+                        "ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(meta::or_<SearcherConcept<Rng, T>, PatternConcept<Rng, T>>(),
+                        "The second argument to view::search_all must be either a range whose "
+                        "value type is EqualityComparable with that of the first, or a "
+                        "Searcher, such as ranges::boyer_moore_horspool_searcher, that is "
+                        "callable with the first range's iterator and sentinel.");
+                }
+            #endif
+            };
+
+            /// \relates search_all_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& search_all = static_const<view<search_all_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -21,7 +21,7 @@
 #include <range/v3/range_interface.hpp>
 #include <range/v3/range.hpp>
 #include <range/v3/utility/meta.hpp>
-#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/cache.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/counted_iterator.hpp>
@@ -71,23 +71,26 @@ namespace ranges
                 return next(ranges::begin(rng), i);
             }
 
-            template<typename Rng, bool IsRandomAccess = RandomAccessIterable<Rng>()>
+            // Without random access, the begin is found by walking from the
+            // begin of the underlying range, and is kept in a lazy_cache.
+            template<typename Rng, typename Cache, bool IsRandomAccess = RandomAccessIterable<Rng>()>
             struct slice_view_
-              : range_facade<slice_view<Rng>, false>
+              : range_facade<slice_view<Rng, Cache>, false>
             {
             private:
                 friend range_access;
                 using difference_type_ = range_difference_t<Rng>;
                 Rng rng_;
                 difference_type_ from_, count_;
-                optional<range_iterator_t<Rng>> begin_;
+                detail::lazy_cache<range_iterator_t<Rng>, Cache> begin_;
 
                 range_iterator_t<Rng> get_begin_()
                 {
-                    if(!begin_)
-                        begin_ = detail::pos_at_(rng_, from_, iterable_concept<Rng>{},
+                    return begin_.get([this]
+                    {
+                        return detail::pos_at_(rng_, from_, iterable_concept<Rng>{},
                             is_infinite<Rng>{});
-                    return *begin_;
+                    });
                 }
                 detail::counted_cursor<range_iterator_t<Rng>> begin_cursor()
                 {
@@ -138,9 +141,9 @@ namespace ranges
                 }
             };
 
-            template<typename Rng>
-            struct slice_view_<Rng, true>
-              : range_interface<slice_view<Rng>>
+            template<typename Rng, typename Cache>
+            struct slice_view_<Rng, Cache, true>
+              : range_interface<slice_view<Rng, Cache>>
             {
             private:
                 using difference_type_ = range_difference_t<Rng>;
@@ -207,11 +210,16 @@ namespace ranges
 
         /// \addtogroup group-views
         /// @{
-        template<typename Rng>
+        /// Over a range without random access, the view finds its begin the
+        /// first time it is asked for it, and keeps it, like `view::remove_if`:
+        /// with the default \c single_threaded_cache, in a plain member, and
+        /// with a \c shared_cache, synchronized, so that threads can share the
+        /// view from the start.
+        template<typename Rng, typename Cache /*= single_threaded_cache*/>
         struct slice_view
-          : detail::slice_view_<Rng>
+          : detail::slice_view_<Rng, Cache>
         {
-            using detail::slice_view_<Rng>::slice_view_;
+            using detail::slice_view_<Rng, Cache>::slice_view_;
         };
 
         namespace view
@@ -221,14 +229,14 @@ namespace ranges
             private:
                 friend view_access;
 
-                template<typename Rng>
-                static slice_view<all_t<Rng>>
+                template<typename Cache, typename Rng>
+                static slice_view<all_t<Rng>, Cache>
                 invoke_(Rng && rng, range_difference_t<Rng> from, range_difference_t<Rng> count,
                     concepts::InputIterable *, concepts::Iterable * = nullptr)
                 {
                     return {all(std::forward<Rng>(rng)), from, count};
                 }
-                template<typename Rng,
+                template<typename Cache, typename Rng,
                     CONCEPT_REQUIRES_(!Range<Rng>() && std::is_lvalue_reference<Rng>())>
                 static range<range_iterator_t<Rng>>
                 invoke_(Rng && rng, range_difference_t<Rng> from, range_difference_t<Rng> count,
@@ -238,24 +246,30 @@ namespace ranges
                     return {it, it + count};
                 }
 
-                // Overloads for the pipe syntax: rng | view::slice(from,to)
-                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(slice_fn slice, Int from, Int to)
+                // Overloads for the pipe syntax: rng | view::slice(from,to), with
+                // an optional caching policy after the bounds
+                template<typename Int, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(Integral<Int>() && detail::is_cache_policy<Cache>())>
+                static auto bind(slice_fn slice, Int from, Int to, Cache cache = Cache{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to))
+                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to, cache))
                 )
-                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(slice_fn slice, Int from, detail::from_end_<Int> to)
+                template<typename Int, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(Integral<Int>() && detail::is_cache_policy<Cache>())>
+                static auto bind(slice_fn slice, Int from, detail::from_end_<Int> to,
+                    Cache cache = Cache{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to))
+                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to, cache))
                 )
-                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(slice_fn slice, detail::from_end_<Int> from, detail::from_end_<Int> to)
+                template<typename Int, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(Integral<Int>() && detail::is_cache_policy<Cache>())>
+                static auto bind(slice_fn slice, detail::from_end_<Int> from, detail::from_end_<Int> to,
+                    Cache cache = Cache{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to))
+                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to, cache))
                 )
                 template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
                 static auto bind(slice_fn slice, Int from, end_fn)
@@ -263,61 +277,65 @@ namespace ranges
                 (
                     make_pipeable(std::bind(ranges::view::drop, std::placeholders::_1, from))
                 )
-                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(slice_fn slice, detail::from_end_<Int> from, end_fn to)
+                template<typename Int, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(Integral<Int>() && detail::is_cache_policy<Cache>())>
+                static auto bind(slice_fn slice, detail::from_end_<Int> from, end_fn to,
+                    Cache cache = Cache{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to))
+                    make_pipeable(std::bind(slice, std::placeholders::_1, from, to, cache))
                 )
 
             public:
                 // slice(rng, 2, 4)
-                template<typename Rng,
-                    CONCEPT_REQUIRES_(InputIterable<Rng>())>
+                template<typename Rng, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(InputIterable<Rng>() && detail::is_cache_policy<Cache>())>
                 auto operator()(Rng && rng, range_difference_t<Rng> from,
-                    range_difference_t<Rng> to) const ->
-                    decltype(slice_fn::invoke_(std::forward<Rng>(rng), from, to - from,
+                    range_difference_t<Rng> to, Cache = Cache{}) const ->
+                    decltype(slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from, to - from,
                         iterable_concept<Rng>{}))
                 {
                     RANGES_ASSERT(0 <= from && from <= to);
-                    return slice_fn::invoke_(std::forward<Rng>(rng), from, to - from,
+                    return slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from, to - from,
                         iterable_concept<Rng>{});
                 }
                 // slice(rng, 4, end-2)
                 //  TODO Support Forward, non-Sized iterables by returning a range that
                 //       doesn't know it's size?
-                template<typename Rng,
-                    CONCEPT_REQUIRES_(InputIterable<Rng>() && SizedIterable<Rng>())>
+                template<typename Rng, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(InputIterable<Rng>() && SizedIterable<Rng>() &&
+                        detail::is_cache_policy<Cache>())>
                 auto operator()(Rng && rng, range_difference_t<Rng> from,
-                    detail::from_end_<range_difference_t<Rng>> to) const ->
-                    decltype(slice_fn::invoke_(std::forward<Rng>(rng), from,
+                    detail::from_end_<range_difference_t<Rng>> to, Cache = Cache{}) const ->
+                    decltype(slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from,
                         distance(rng) + to.dist_ - from, iterable_concept<Rng>{}))
                 {
                     static_assert(!is_infinite<Rng>(),
                         "Can't index from the end of an infinite range!");
                     RANGES_ASSERT(0 <= from);
                     RANGES_ASSERT(from <= distance(rng) + to.dist_);
-                    return slice_fn::invoke_(std::forward<Rng>(rng), from,
+                    return slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from,
                         distance(rng) + to.dist_ - from, iterable_concept<Rng>{});
                 }
                 // slice(rng, end-4, end-2)
-                template<typename Rng,
-                    CONCEPT_REQUIRES_((InputIterable<Rng>() && SizedIterable<Rng>()) ||
-                        ForwardIterable<Rng>())>
+                template<typename Rng, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(((InputIterable<Rng>() && SizedIterable<Rng>()) ||
+                        ForwardIterable<Rng>()) && detail::is_cache_policy<Cache>())>
                 auto operator()(Rng && rng, detail::from_end_<range_difference_t<Rng>> from,
-                    detail::from_end_<range_difference_t<Rng>> to) const ->
-                    decltype(slice_fn::invoke_(std::forward<Rng>(rng), from.dist_,
+                    detail::from_end_<range_difference_t<Rng>> to, Cache = Cache{}) const ->
+                    decltype(slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from.dist_,
                         to.dist_ - from.dist_, iterable_concept<Rng>{},
                         bounded_iterable_concept<Rng>{}()))
                 {
                     static_assert(!is_infinite<Rng>(),
                         "Can't index from the end of an infinite range!");
                     RANGES_ASSERT(from.dist_ <= to.dist_);
-                    return slice_fn::invoke_(std::forward<Rng>(rng), from.dist_,
+                    return slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from.dist_,
                         to.dist_ - from.dist_, iterable_concept<Rng>{},
                         bounded_iterable_concept<Rng>{}());
                 }
-                // slice(rng, 4, end)
+                // slice(rng, 4, end), which is view::drop, and keeps its
+                // single-threaded cache
                 template<typename Rng,
                     CONCEPT_REQUIRES_(InputIterable<Rng>())>
                 auto operator()(Rng && rng, range_difference_t<Rng> from, end_fn) const ->
@@ -327,18 +345,18 @@ namespace ranges
                     return ranges::view::drop(std::forward<Rng>(rng), from);
                 }
                 // slice(rng, end-4, end)
-                template<typename Rng,
-                    CONCEPT_REQUIRES_((InputIterable<Rng>() && SizedIterable<Rng>()) ||
-                        ForwardIterable<Rng>())>
+                template<typename Rng, typename Cache = single_threaded_cache,
+                    CONCEPT_REQUIRES_(((InputIterable<Rng>() && SizedIterable<Rng>()) ||
+                        ForwardIterable<Rng>()) && detail::is_cache_policy<Cache>())>
                 auto operator()(Rng && rng, detail::from_end_<range_difference_t<Rng>> from,
-                    end_fn) const ->
-                    decltype(slice_fn::invoke_(std::forward<Rng>(rng), from.dist_,
+                    end_fn, Cache = Cache{}) const ->
+                    decltype(slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from.dist_,
                         -from.dist_, iterable_concept<Rng>{},
                         bounded_iterable_concept<Rng>{}()))
                 {
                     static_assert(!is_infinite<Rng>(),
                         "Can't index from the end of an infinite range!");
-                    return slice_fn::invoke_(std::forward<Rng>(rng), from.dist_,
+                    return slice_fn::invoke_<Cache>(std::forward<Rng>(rng), from.dist_,
                         -from.dist_, iterable_concept<Rng>{},
                         bounded_iterable_concept<Rng>{}());
                 }
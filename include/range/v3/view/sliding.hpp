@@ -0,0 +1,261 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SLIDING_HPP
+#define RANGES_V3_VIEW_SLIDING_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/all.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The windows of \c n consecutive elements of the adapted forward
+        /// range, each a `sized_range` of its iterators: the first starts at
+        /// the first element, the next at the second, and so on, up to the one
+        /// that ends at the last element. A range with fewer than \c n elements
+        /// has no windows. Over a sized random-access range, the windows form a
+        /// sized random-access range, and the i-th is found in O(1). Otherwise,
+        /// the iterators keep the first and the last element of the window, and
+        /// moving on to the next window increments the two.
+        template<typename Rng>
+        struct sliding_view
+          : range_facade<sliding_view<Rng>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            Rng rng_;
+            difference_type_ n_;
+
+            using indexed_t = meta::and_<RandomAccessIterable<Rng>, SizedIterable<Rng>>;
+
+            template<bool IsConst>
+            struct indexed_cursor
+            {
+            private:
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t first_;
+                difference_type_ n_;
+                difference_type_ index_;
+            public:
+                indexed_cursor() = default;
+                indexed_cursor(base_t &rng, difference_type_ n, difference_type_ index)
+                  : first_(ranges::begin(rng)), n_(n), index_(index)
+                {}
+                sized_range<iterator_t> current() const
+                {
+                    return {first_ + index_, first_ + (index_ + n_),
+                        static_cast<iterator_size_t<iterator_t>>(n_)};
+                }
+                void next()
+                {
+                    ++index_;
+                }
+                void prev()
+                {
+                    --index_;
+                }
+                void advance(difference_type_ n)
+                {
+                    index_ += n;
+                }
+                bool equal(indexed_cursor const &that) const
+                {
+                    return index_ == that.index_;
+                }
+                difference_type_ distance_to(indexed_cursor const &that) const
+                {
+                    return that.index_ - index_;
+                }
+            };
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t cur_;
+                // The last element of the window, or the end if there is none
+                iterator_t back_;
+                range_sentinel_t<base_t> last_;
+                difference_type_ n_;
+            public:
+                cursor() = default;
+                cursor(base_t &rng, difference_type_ n, begin_tag)
+                  : cur_(ranges::begin(rng)), back_(cur_), last_(ranges::end(rng)), n_(n)
+                {
+                    ranges::advance(back_, n_ - 1, last_);
+                }
+                sized_range<iterator_t> current() const
+                {
+                    return {cur_, ranges::next(back_),
+                        static_cast<iterator_size_t<iterator_t>>(n_)};
+                }
+                void next()
+                {
+                    ++cur_;
+                    ++back_;
+                }
+                bool done() const
+                {
+                    return back_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+            };
+
+            template<bool IsConst>
+            using cursor_t = meta::if_<indexed_t, indexed_cursor<IsConst>, cursor<IsConst>>;
+            template<bool IsConst>
+            using end_cursor_t = meta::if_<indexed_t, indexed_cursor<IsConst>, default_sentinel>;
+
+            template<bool IsConst, typename Self>
+            static cursor_t<IsConst> begin_cursor_(Self &self, std::true_type)
+            {
+                return {self.rng_, self.n_, 0};
+            }
+            template<bool IsConst, typename Self>
+            static cursor_t<IsConst> begin_cursor_(Self &self, std::false_type)
+            {
+                return {self.rng_, self.n_, begin_tag{}};
+            }
+            template<bool IsConst, typename Self>
+            static end_cursor_t<IsConst> end_cursor_(Self &self, std::true_type)
+            {
+                return {self.rng_, self.n_, static_cast<difference_type_>(self.size())};
+            }
+            template<bool IsConst, typename Self>
+            static end_cursor_t<IsConst> end_cursor_(Self &, std::false_type)
+            {
+                return {};
+            }
+            cursor_t<false> begin_cursor()
+            {
+                return sliding_view::begin_cursor_<false>(*this, indexed_t{});
+            }
+            end_cursor_t<false> end_cursor()
+            {
+                return sliding_view::end_cursor_<false>(*this, indexed_t{});
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            cursor_t<true> begin_cursor() const
+            {
+                return sliding_view::begin_cursor_<true>(*this, indexed_t{});
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            end_cursor_t<true> end_cursor() const
+            {
+                return sliding_view::end_cursor_<true>(*this, indexed_t{});
+            }
+        public:
+            sliding_view() = default;
+            sliding_view(Rng rng, difference_type_ n)
+              : rng_(std::move(rng)), n_(n)
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            range_size_t<Rng> size() const
+            {
+                auto const size = ranges::size(rng_);
+                auto const n = static_cast<range_size_t<Rng>>(n_);
+                return size < n ? 0 : size - n + 1;
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct sliding_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_fn sliding, Int n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n))
+                )
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Int, CONCEPT_REQUIRES_(!Integral<Int>())>
+                static detail::null_pipe bind(sliding_fn, Int)
+                {
+                    CONCEPT_ASSERT_MSG(Integral<Int>(),
+                        "The object passed to view::sliding must be a model of the Integral "
+                        "concept.");
+                    return {};
+                }
+            #endif
+            public:
+                template<typename Rng, CONCEPT_REQUIRES_(ForwardIterable<Rng>())>
+                sliding_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    return {all(std::forward<Rng>(rng)), n};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T,
+                    CONCEPT_REQUIRES_(!ForwardIterable<Rng>())>
+                void operator()(Rng &&, T) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object to be operated on by view::sliding should be a model of "
+                        "the ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(Integral<T>(),
+                        "The second argument to view::sliding must be a model of the Integral "
+                        "concept.");
+                }
+            #endif
+            };
+
+            /// \relates sliding_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& sliding = static_const<view<sliding_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_SPLIT_HPP
 #define RANGES_V3_VIEW_SPLIT_HPP
 
+#include <cstring>
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
@@ -26,12 +27,10 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
-#include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/algorithm/searchers.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
-#include <range/v3/view/iota.hpp>
-#include <range/v3/view/indirect.hpp>
-#include <range/v3/view/take_while.hpp>
 
 namespace ranges
 {
@@ -39,6 +38,12 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+
+        /// Each element of a `split_view` is a `range` of the underlying iterators,
+        /// so it is sized when those are random access. The searcher is called with
+        /// the current position and the end, and returns the bounds of the first
+        /// delimiter at or after the current position, or an empty range at the
+        /// end if there is none. Every delimiter is searched for exactly once.
         template<typename Rng, typename Fun>
         struct split_view
           : range_facade<split_view<Rng, Fun>>
@@ -54,49 +59,39 @@ namespace ranges
             private:
                 friend range_access;
                 friend split_view;
+                using fun_ref_t = semiregular_ref_or_val_t<invokable_t<Fun>, IsConst>;
                 bool zero_;
                 range_iterator_t<Rng> cur_;
+                // The delimiter that ends the current element
+                range_iterator_t<Rng> match_begin_;
+                range_iterator_t<Rng> match_end_;
                 range_sentinel_t<Rng> last_;
-                using fun_ref_t = semiregular_ref_or_val_t<invokable_t<Fun>, IsConst>;
                 fun_ref_t fun_;
 
-                struct search_pred
+                void find_match()
                 {
-                    bool zero_;
-                    range_iterator_t<Rng> first_;
-                    range_sentinel_t<Rng> last_;
-                    fun_ref_t fun_;
-                    bool operator()(range_iterator_t<Rng> cur) const
-                    {
-                        return (zero_ && cur == first_) || (cur != last_ && !fun_(cur, last_).first);
-                    }
-                };
-                using reference_ =
-                    indirect_view<
-                        take_while_view<
-                            iota_view<range_iterator_t<Rng>>,
-                            search_pred,
-                            is_infinite<Rng>::value>>;
-                reference_ current() const
+                    RANGES_ASSERT(cur_ != last_);
+                    // If the last match consumed zero elements, the element
+                    // starting here holds at least one.
+                    auto it = cur_;
+                    if(zero_)
+                        ++it;
+                    std::pair<range_iterator_t<Rng>, range_iterator_t<Rng>> p =
+                        fun_(std::move(it), last_);
+                    match_begin_ = std::move(p.first);
+                    match_end_ = std::move(p.second);
+                }
+                range<range_iterator_t<Rng>> current() const
                 {
-                    return reference_{{view::iota(cur_), {zero_, cur_, last_, fun_}}};
+                    return {cur_, match_begin_};
                 }
                 void next()
                 {
                     RANGES_ASSERT(cur_ != last_);
-                    // If the last match consumed zero elements, bump the position.
-                    advance(cur_, (int)zero_, last_);
-                    zero_ = false;
-                    for(; cur_ != last_; ++cur_)
-                    {
-                        std::pair<bool, range_difference_t<Rng>> p = fun_(cur_, last_);
-                        if(p.first)
-                        {
-                            advance(cur_, p.second);
-                            zero_ = (0 == p.second);
-                            return;
-                        }
-                    }
+                    zero_ = match_begin_ == match_end_;
+                    cur_ = match_end_;
+                    if(cur_ != last_)
+                        this->find_match();
                 }
                 bool done() const
                 {
@@ -107,11 +102,18 @@ namespace ranges
                     return cur_ == that.cur_;
                 }
                 cursor(fun_ref_t fun, range_iterator_t<Rng> first, range_sentinel_t<Rng> last)
-                  : cur_(first), last_(last), fun_(fun)
+                  : zero_(false), cur_(first), match_begin_(first), match_end_(first)
+                  , last_(last), fun_(fun)
                 {
+                    if(cur_ == last_)
+                        return;
+                    this->find_match();
                     // For skipping an initial zero-length match
-                    auto p = fun(first, last);
-                    zero_ = p.first && 0 == p.second;
+                    if(match_begin_ == cur_ && match_end_ == cur_)
+                    {
+                        zero_ = true;
+                        this->find_match();
+                    }
                 }
             public:
                 cursor() = default;
@@ -146,43 +148,152 @@ namespace ranges
                     make_pipeable(std::bind(split, std::placeholders::_1, bind_forward<T>(t)))
                 )
                 template<typename Rng>
-                struct element_pred
+                using search_result_t = std::pair<range_iterator_t<Rng>, range_iterator_t<Rng>>;
+
+                // Adapts a function that tests for a delimiter at a single position.
+                template<typename Rng, typename Fun>
+                struct function_searcher
                 {
-                    range_value_t<Rng> val_;
-                    std::pair<bool, range_difference_t<Rng>>
+                private:
+                    semiregular_t<invokable_t<Fun>> fun_;
+                    template<typename F>
+                    static search_result_t<Rng>
+                    search(F &fun, range_iterator_t<Rng> cur, range_sentinel_t<Rng> end)
+                    {
+                        for(; cur != end; ++cur)
+                        {
+                            std::pair<bool, range_difference_t<Rng>> p = fun(cur, end);
+                            if(p.first)
+                                return {cur, next(cur, p.second)};
+                        }
+                        return {cur, cur};
+                    }
+                public:
+                    function_searcher() = default;
+                    function_searcher(Fun fun)
+                      : fun_(invokable(std::move(fun)))
+                    {}
+                    search_result_t<Rng>
+                    operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end)
+                    {
+                        return function_searcher::search(fun_, std::move(cur), std::move(end));
+                    }
+                    template<typename F = Fun,
+                        CONCEPT_REQUIRES_(Invokable<F const, range_iterator_t<Rng>,
+                            range_sentinel_t<Rng>>())>
+                    search_result_t<Rng>
                     operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
                     {
-                        using P = std::pair<bool, range_difference_t<Rng>>;
-                        RANGES_ASSERT(cur != end);
-                        return *cur == val_ ? P{true, 1} : P{false, 0};
+                        return function_searcher::search(fun_, std::move(cur), std::move(end));
+                    }
+                };
+                template<typename Rng>
+                struct element_searcher
+                {
+                private:
+                    using I = range_iterator_t<Rng>;
+                    using S = range_sentinel_t<Rng>;
+                    static search_result_t<Rng> search(I cur, S end, range_value_t<Rng> const &val,
+                        std::false_type)
+                    {
+                        while(cur != end && !(*cur == val))
+                            ++cur;
+                        if(cur == end)
+                            return {cur, cur};
+                        return {cur, next(cur)};
+                    }
+                    static search_result_t<Rng> search(I cur, S end, range_value_t<Rng> const &val,
+                        std::true_type)
+                    {
+                        auto const n = distance(cur, end);
+                        if(0 == n)
+                            return {cur, cur};
+                        auto const p = detail::byte_pointer(cur);
+                        auto const q = static_cast<unsigned char const *>(std::memchr(p,
+                            static_cast<unsigned char>(val), static_cast<std::size_t>(n)));
+                        if(!q)
+                        {
+                            cur += n;
+                            return {cur, cur};
+                        }
+                        cur += q - p;
+                        return {cur, next(cur)};
+                    }
+                public:
+                    range_value_t<Rng> val_;
+                    search_result_t<Rng> operator()(I cur, S end) const
+                    {
+                        return element_searcher::search(std::move(cur), std::move(end), val_,
+                            detail::is_byte_pointer_range<I, S>());
                     }
                 };
                 template<typename Rng, typename Sub>
-                struct subrange_pred
+                struct subrange_searcher
                 {
+                private:
+                    using I = range_iterator_t<Rng>;
+                    using S = range_sentinel_t<Rng>;
                     all_t<Sub> sub_;
                     range_difference_t<Sub> len_;
-                    subrange_pred() = default;
-                    subrange_pred(Sub && sub)
-                      : sub_(all(std::forward<Sub>(sub))), len_(distance(sub_))
-                    {}
-                    std::pair<bool, range_difference_t<Rng>>
-                    operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+
+                    search_result_t<Rng> search(I cur, S end, std::false_type) const
                     {
-                        RANGES_ASSERT(cur != end);
-                        if(SizedIteratorRange<range_iterator_t<Rng>, range_sentinel_t<Rng>>() && 
-                            distance(cur, end) < len_)
-                            return {false, 0};
-                        auto pat_cur = ranges::begin(sub_);
-                        auto pat_end = ranges::end(sub_);
-                        for(;; ++cur, ++pat_cur)
+                        for(;; ++cur)
                         {
-                            if(pat_cur == pat_end)
-                                return {true, len_};
-                            if(cur == end || !(*cur == *pat_cur))
-                                return {false, 0};
+                            if(SizedIteratorRange<I, S>() && distance(cur, end) < len_)
+                            {
+                                cur = next(cur, end);
+                                return {cur, cur};
+                            }
+                            auto it = cur;
+                            auto pat_cur = ranges::begin(sub_);
+                            auto pat_end = ranges::end(sub_);
+                            for(;; ++it, ++pat_cur)
+                            {
+                                if(pat_cur == pat_end)
+                                    return {cur, it};
+                                if(it == end)
+                                    return {it, it};
+                                if(!(*it == *pat_cur))
+                                    break;
+                            }
                         }
                     }
+                    search_result_t<Rng> search(I cur, S end, std::true_type) const
+                    {
+                        auto const n = distance(cur, end);
+                        if(0 == len_)
+                            return {cur, cur};
+                        if(n < len_)
+                        {
+                            cur += n;
+                            return {cur, cur};
+                        }
+                        auto const first = detail::byte_pointer(cur);
+                        auto const p = detail::byte_search(first, static_cast<std::size_t>(n),
+                            detail::byte_pointer(ranges::begin(sub_)),
+                            static_cast<std::size_t>(len_));
+                        if(!p)
+                        {
+                            cur += n;
+                            return {cur, cur};
+                        }
+                        cur += p - first;
+                        return {cur, cur + len_};
+                    }
+                public:
+                    subrange_searcher() = default;
+                    subrange_searcher(Sub && sub)
+                      : sub_(all(std::forward<Sub>(sub))), len_(distance(sub_))
+                    {}
+                    search_result_t<Rng> operator()(I cur, S end) const
+                    {
+                        return this->search(std::move(cur), std::move(end), meta::and_<
+                            detail::is_byte_pointer_range<I, S>,
+                            detail::is_byte_pointer_range<range_iterator_t<Sub>,
+                                range_sentinel_t<Sub>>,
+                            std::is_same<range_value_t<Rng>, range_value_t<Sub>>>());
+                    }
                 };
             public:
                 template<typename Rng, typename Fun>
@@ -204,24 +315,35 @@ namespace ranges
                     ForwardIterable<Sub>,
                     EqualityComparable<range_value_t<Rng>, range_value_t<Sub>>>;
 
+                template<typename Rng, typename Srch>
+                using SearcherConcept = meta::and_<
+                    ForwardIterable<Rng>,
+                    Searcher<Srch, range_iterator_t<Rng>, range_sentinel_t<Rng>>>;
+
                 template<typename Rng, typename Fun,
                     CONCEPT_REQUIRES_(FunctionConcept<Rng, Fun>())>
-                split_view<all_t<Rng>, Fun> operator()(Rng && rng, Fun fun) const
+                split_view<all_t<Rng>, function_searcher<Rng, Fun>> operator()(Rng && rng, Fun fun) const
                 {
                     return {all(std::forward<Rng>(rng)), std::move(fun)};
                 }
                 template<typename Rng,
                     CONCEPT_REQUIRES_(ElementConcept<Rng>())>
-                split_view<all_t<Rng>, element_pred<Rng>> operator()(Rng && rng, range_value_t<Rng> val) const
+                split_view<all_t<Rng>, element_searcher<Rng>> operator()(Rng && rng, range_value_t<Rng> val) const
                 {
                     return {all(std::forward<Rng>(rng)), {std::move(val)}};
                 }
                 template<typename Rng, typename Sub,
                     CONCEPT_REQUIRES_(SubRangeConcept<Rng, Sub>())>
-                split_view<all_t<Rng>, subrange_pred<Rng, Sub>> operator()(Rng && rng, Sub && sub) const
+                split_view<all_t<Rng>, subrange_searcher<Rng, Sub>> operator()(Rng && rng, Sub && sub) const
                 {
                     return {all(std::forward<Rng>(rng)), {std::forward<Sub>(sub)}};
                 }
+                template<typename Rng, typename Srch,
+                    CONCEPT_REQUIRES_(SearcherConcept<Rng, Srch>())>
+                split_view<all_t<Rng>, Srch> operator()(Rng && rng, Srch searcher) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(searcher)};
+                }
 
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
@@ -236,10 +358,13 @@ namespace ranges
                         "(1) A single element of the range's value type, where the value type is a "
                         "model of the Regular concept, "
                         "(2) A ForwardIterable whose value type is EqualityComparable to the input "
-                        "range's value type, or "
+                        "range's value type, "
                         "(3) A Function that is callable with two arguments: the range's iterator "
                         "and sentinel, and that returns a std::pair<bool, D>, where D is the "
-                        "input range's difference_type.");
+                        "input range's difference_type, or "
+                        "(4) A Searcher, such as ranges::default_searcher, that is callable with "
+                        "the range's iterator and sentinel, and that returns a std::pair<I, I> "
+                        "bounding the first delimiter, where I is the range's iterator type.");
                 }
             #endif
             };
@@ -26,6 +26,7 @@
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/box.hpp>
+#include <range/v3/utility/cache.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -38,9 +39,16 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
-        template<typename Rng>
+        /// The iterators of a stride view remember how far short of a multiple
+        /// of the stride the end of the underlying range is, and work it out
+        /// lazily. The view itself caches nothing, so there is nothing to warm
+        /// by calling `begin()`. With the default \c shared_cache, what the
+        /// iterators remember is atomic, so threads can share an iterator and
+        /// call its const members; with a \c single_threaded_cache, it is kept
+        /// in plain members, and threads must not share an iterator.
+        template<typename Rng, typename Cache /*= shared_cache*/>
         struct stride_view
-          : range_adaptor<stride_view<Rng>, Rng>
+          : range_adaptor<stride_view<Rng, Cache>, Rng>
         {
         private:
             friend range_access;
@@ -55,7 +63,7 @@ namespace ranges
             using dirty_t =
                 meta::if_c<
                     (BidirectionalIterable<Rng>() && !SizedIterable<Rng>()),
-                    mutable_<std::atomic<bool>>,
+                    detail::cache_cell_t<bool, Cache>,
                     constant<bool, false>>;
 
             // Bidirectional and random-access stride iterators need to remember how
@@ -64,7 +72,7 @@ namespace ranges
             using offset_t =
                 meta::if_<
                     BidirectionalIterable<Rng>,
-                    mutable_<std::atomic<difference_type_>>,
+                    detail::cache_cell_t<difference_type_, Cache>,
                     constant<difference_type_, 0>>;
 
             difference_type_ stride_;
@@ -80,8 +88,9 @@ namespace ranges
                 offset_t const & offset() const { return *this; }
                 void clean() const
                 {
-                    // Harmless race here. Two threads might compute offset and set it
-                    // independently, but the result would be the same.
+                    // With a shared cache, a harmless race here. Two threads might
+                    // compute offset and set it independently, but the result would be
+                    // the same.
                     if(dirty())
                     {
                         do_clean();
@@ -90,7 +99,7 @@ namespace ranges
                 }
                 void do_clean() const
                 {
-                    auto tmp = ranges::distance(rng_->base()) % rng_->stride_;
+                    auto tmp = ranges::distance(rng_->mutable_base()) % rng_->stride_;
                     offset() = 0 != tmp ? rng_->stride_ - tmp : tmp;
                 }
             public:
@@ -189,6 +198,14 @@ namespace ranges
                 (
                     make_pipeable(std::bind(stride, std::placeholders::_1, std::move(step)))
                 )
+                template<typename Difference, typename Cache,
+                    CONCEPT_REQUIRES_(Integral<Difference>() && detail::is_cache_policy<Cache>())>
+                static auto bind(stride_fn stride, Difference step, Cache cache)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(stride, std::placeholders::_1, std::move(step),
+                        cache))
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Difference, CONCEPT_REQUIRES_(!Integral<Difference>())>
                 static detail::null_pipe bind(stride_fn, Difference &&)
@@ -207,6 +224,16 @@ namespace ranges
                 {
                     return {all(std::forward<Rng>(rng)), step};
                 }
+                /// With the given caching policy, \c single_threaded_cache or \c
+                /// shared_cache
+                template<typename Rng, typename Cache,
+                    CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                        detail::is_cache_policy<Cache>())>
+                stride_view<all_t<Rng>, Cache>
+                operator()(Rng && rng, range_difference_t<Rng> step, Cache) const
+                {
+                    return {all(std::forward<Rng>(rng)), step};
+                }
 
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
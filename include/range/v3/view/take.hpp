@@ -139,6 +139,21 @@ namespace ranges
             using detail::take_view_<Rng>::take_view_;
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_take_view_
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct is_take_view_<take_view<Rng>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct take_fn
@@ -158,6 +173,14 @@ namespace ranges
                 {
                     return {begin(rng), next(begin(rng), to)};
                 }
+                // The first \c to elements of the first \c n are the first
+                // `min(n, to)`, so a take of a take is a single take.
+                template<typename Rng>
+                static take_view<Rng> fuse_(take_view<Rng> rng, range_difference_t<Rng> to)
+                {
+                    auto const n = static_cast<range_difference_t<Rng>>(rng.size());
+                    return {std::move(rng.base()), n < to ? n : to};
+                }
 
                 template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
                 static auto bind(take_fn take, Int to)
@@ -175,12 +198,21 @@ namespace ranges
                 }
             #endif
             public:
-                template<typename Rng, CONCEPT_REQUIRES_(InputIterable<Rng>())>
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputIterable<Rng>() &&
+                        !detail::is_take_view_<uncvref_t<Rng>>::value)>
                 auto operator()(Rng && rng, range_difference_t<Rng> to) const
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
                     take_fn::invoke_(std::forward<Rng>(rng), to, iterable_concept<Rng>{})
                 )
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(detail::is_take_view_<uncvref_t<Rng>>::value)>
+                auto operator()(Rng && rng, range_difference_t<Rng> to) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    take_fn::fuse_(std::forward<Rng>(rng), to)
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T, CONCEPT_REQUIRES_(!InputIterable<Rng>())>
                 void operator()(Rng &&, T &&) const
@@ -0,0 +1,157 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_TOP_K_HPP
+#define RANGES_V3_VIEW_TOP_K_HPP
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_interface.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/top_k.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+        template<typename Rng, typename Pred, typename Proj>
+        struct top_k_view
+          : range_interface<top_k_view<Rng, Pred, Proj>>
+        {
+        private:
+            using value_type_ = range_value_t<Rng>;
+            using buffer_t = std::vector<value_type_>;
+            Rng rng_;
+            range_difference_t<Rng> k_;
+            semiregular_t<invokable_t<Pred>> pred_;
+            semiregular_t<invokable_t<Proj>> proj_;
+            // The selection runs once, on the first call to begin() on the view
+            // or any copy of it. The constructor makes the slot for the result,
+            // so that copies made before that call share it too: copying stays
+            // O(1), and a single-pass source is only consumed once.
+            std::shared_ptr<optional<buffer_t>> buf_;
+            buffer_t & buffer()
+            {
+                if(!buf_)
+                    buf_ = std::make_shared<optional<buffer_t>>();
+                if(!*buf_)
+                    *buf_ = detail::top_k<value_type_>(
+                        ranges::begin(rng_), ranges::end(rng_), k_, pred_, proj_);
+                return **buf_;
+            }
+        public:
+            using iterator = typename buffer_t::iterator;
+
+            top_k_view() = default;
+            top_k_view(Rng rng, range_difference_t<Rng> k, Pred pred, Proj proj)
+              : rng_(std::move(rng))
+              , k_(k)
+              , pred_(invokable(std::move(pred)))
+              , proj_(invokable(std::move(proj)))
+              , buf_(std::make_shared<optional<buffer_t>>())
+            {}
+            iterator begin()
+            {
+                return buffer().begin();
+            }
+            iterator end()
+            {
+                return buffer().end();
+            }
+            range_size_t<Rng> size()
+            {
+                return static_cast<range_size_t<Rng>>(buffer().size());
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct top_k_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, typename Pred = ordered_less, typename Proj = ident,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(top_k_fn top_k, Int k, Pred pred = Pred{}, Proj proj = Proj{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(top_k, std::placeholders::_1, k,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+            public:
+                template<typename Rng, typename Pred, typename Proj>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    TopKConcept<range_iterator_t<Rng>, Pred, Proj>>;
+
+                template<typename Rng, typename Pred = ordered_less, typename Proj = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred, Proj>())>
+                top_k_view<all_t<Rng>, Pred, Proj>
+                operator()(Rng && rng, range_difference_t<Rng> k, Pred pred = Pred{},
+                    Proj proj = Proj{}) const
+                {
+                    return {all(std::forward<Rng>(rng)), k, std::move(pred), std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Int, typename Pred = ordered_less,
+                    typename Proj = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Pred, Proj>())>
+                void operator()(Rng &&, Int, Pred = Pred{}, Proj = Proj{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The first argument to view::top_k must be a model of the "
+                        "InputIterable concept");
+                    CONCEPT_ASSERT_MSG(Integral<Int>(),
+                        "The second argument to view::top_k must be a model of the "
+                        "Integral concept");
+                    CONCEPT_ASSERT_MSG(TopKConcept<range_iterator_t<Rng>, Pred, Proj>(),
+                        "The elements of the range passed to view::top_k must be copyable "
+                        "into a buffer and sortable with the given predicate and projection");
+                }
+            #endif
+            };
+
+            /// \relates top_k_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& top_k = static_const<view<top_k_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -45,6 +45,7 @@ namespace ranges
         {
         private:
             friend range_access;
+            friend struct view::transform_fn;
             semiregular_t<invokable_t<Fun>> fun_;
             using use_sentinel_t =
                 meta::or_<meta::not_<BoundedIterable<Rng>>, SinglePass<range_iterator_t<Rng>>>;
@@ -116,6 +117,21 @@ namespace ranges
             {}
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_transform_view_
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Fun>
+            struct is_transform_view_<transform_view<Rng, Fun>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct iter_transform_fn
@@ -186,6 +202,16 @@ namespace ranges
                     make_pipeable(std::bind(transform, std::placeholders::_1,
                         protect(std::move(fun))))
                 )
+                // Transforming by \c fun the elements transformed by \c first is
+                // transforming them by the composition of the two.
+                template<typename Rng, typename First, typename Fun>
+                static transform_view<Rng, composed<invokable_t<Fun>, invokable_t<First>>>
+                fuse_(transform_view<Rng, First> rng, Fun fun)
+                {
+                    auto &first =
+                        static_cast<detail::indirect_fn_<First> const &>(rng.fun_).base();
+                    return {std::move(rng.base()), {invokable(std::move(fun)), first}};
+                }
             public:
                 template<typename Rng, typename Fun>
                 using Concept = meta::and_<
@@ -193,11 +219,20 @@ namespace ranges
                     Invokable<Fun, range_reference_t<Rng> &&>>;
 
                 template<typename Rng, typename Fun,
-                    CONCEPT_REQUIRES_(Concept<Rng, Fun>())>
+                    CONCEPT_REQUIRES_(Concept<Rng, Fun>() &&
+                        !detail::is_transform_view_<uncvref_t<Rng>>::value)>
                 transform_view<all_t<Rng>, Fun> operator()(Rng && rng, Fun fun) const
                 {
                     return {all(std::forward<Rng>(rng)), std::move(fun)};
                 }
+                template<typename Rng, typename Fun,
+                    CONCEPT_REQUIRES_(Concept<Rng, Fun>() &&
+                        detail::is_transform_view_<uncvref_t<Rng>>::value)>
+                auto operator()(Rng && rng, Fun fun) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    transform_fn::fuse_(std::forward<Rng>(rng), std::move(fun))
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Fun,
                     CONCEPT_REQUIRES_(!Concept<Rng, Fun>())>
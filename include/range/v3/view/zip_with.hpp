@@ -112,10 +112,9 @@ namespace ranges
             {
             private:
                 using BaseFn = invokable_t<Fn>;
-
+            public:
                 BaseFn & base()                { return *this; }
                 BaseFn const & base() const    { return *this; }
-            public:
                 indirect_fn_() = default;
                 indirect_fn_(Fn fn)
                   : BaseFn(invokable(std::move(fn)))
@@ -253,6 +252,74 @@ namespace ranges
                 }
             };
 
+            // Zips sized random-access ranges with one index into all of them,
+            // counted up to the least of their sizes, where cursor would
+            // advance and compare an iterator into each at every step. A loop
+            // over the view is then a single counted loop, which the compiler
+            // can vectorize.
+            struct indexed_cursor
+            {
+            private:
+                using fun_ref_ = semiregular_ref_or_val_t<invokable_t<Fun>, true>;
+                fun_ref_ fun_;
+                std::tuple<range_iterator_t<Rngs>...> begins_;
+                difference_type_ index_;
+
+                template<std::size_t...Is>
+                auto current_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_(std::get<Is>(begins_) + index_...)
+                )
+                template<std::size_t...Is>
+                auto indirect_move_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_(move_tag{}, std::get<Is>(begins_) + index_...)
+                )
+                template<typename Sent>
+                friend auto indirect_move(basic_iterator<indexed_cursor, Sent> const &it)
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    get_cursor(it).indirect_move_(make_index_sequence<sizeof...(Rngs)>{})
+                )
+            public:
+                using difference_type = difference_type_;
+                using value_type =
+                    detail::decay_t<decltype(fun_(copy_tag{}, range_iterator_t<Rngs>{}...))>;
+
+                indexed_cursor() = default;
+                indexed_cursor(fun_ref_ fun, std::tuple<range_iterator_t<Rngs>...> begins,
+                    difference_type index)
+                  : fun_(std::move(fun)), begins_(std::move(begins)), index_(index)
+                {}
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    current_(make_index_sequence<sizeof...(Rngs)>{})
+                )
+                void next()
+                {
+                    ++index_;
+                }
+                bool equal(indexed_cursor const &that) const
+                {
+                    return index_ == that.index_;
+                }
+                void prev()
+                {
+                    --index_;
+                }
+                void advance(difference_type n)
+                {
+                    index_ += n;
+                }
+                difference_type distance_to(indexed_cursor const &that) const
+                {
+                    return that.index_ - index_;
+                }
+            };
+
             struct sentinel
             {
             private:
@@ -275,24 +342,51 @@ namespace ranges
             };
 
             using are_bounded_t = meta::and_c<(bool) BoundedIterable<Rngs>()...>;
+            using are_indexed_t =
+                meta::and_c<((bool) RandomAccessIterable<Rngs>() && (bool) SizedIterable<Rngs>())...>;
+            using cursor_t = meta::if_<are_indexed_t, indexed_cursor, cursor>;
+            using end_cursor_t =
+                meta::if_<are_indexed_t, indexed_cursor, meta::if_<are_bounded_t, cursor, sentinel>>;
+
+            template<typename Self>
+            static cursor begin_cursor_(Self &self, std::false_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, begin)};
+            }
+            template<typename Self>
+            static meta::if_<are_bounded_t, cursor, sentinel> end_cursor_(Self &self, std::false_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, end)};
+            }
+            template<typename Self>
+            static indexed_cursor begin_cursor_(Self &self, std::true_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, begin), 0};
+            }
+            template<typename Self>
+            static indexed_cursor end_cursor_(Self &self, std::true_type)
+            {
+                return {self.fun_, tuple_transform(self.rngs_, begin),
+                    static_cast<difference_type_>(self.size())};
+            }
 
-            cursor begin_cursor()
+            cursor_t begin_cursor()
             {
-                return {fun_, tuple_transform(rngs_, begin)};
+                return iter_zip_with_view::begin_cursor_(*this, are_indexed_t{});
             }
-            meta::if_<are_bounded_t, cursor, sentinel> end_cursor()
+            end_cursor_t end_cursor()
             {
-                return {fun_, tuple_transform(rngs_, end)};
+                return iter_zip_with_view::end_cursor_(*this, are_indexed_t{});
             }
             CONCEPT_REQUIRES(meta::and_c<(bool) Iterable<Rngs const>()...>::value)
-            cursor begin_cursor() const
+            cursor_t begin_cursor() const
             {
-                return {fun_, tuple_transform(rngs_, begin)};
+                return iter_zip_with_view::begin_cursor_(*this, are_indexed_t{});
             }
             CONCEPT_REQUIRES(meta::and_c<(bool) Iterable<Rngs const>()...>::value)
-            meta::if_<are_bounded_t, cursor, sentinel> end_cursor() const
+            end_cursor_t end_cursor() const
             {
-                return {fun_, tuple_transform(rngs_, end)};
+                return iter_zip_with_view::end_cursor_(*this, are_indexed_t{});
             }
         public:
             iter_zip_with_view() = default;
@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::lower_bound, the branchless ranges::lower_bound and
+// eytzinger_index::lower_bound on tables sized from L1 cache up to DRAM, with
+// uniformly random lookups, and the same lookups batched with
+// ranges::lower_bound_many, in random and in sorted order.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/eytzinger_index.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/lower_bound_many.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::vector<int> const &queries, Fun fun)
+{
+    long long sum = 0;
+    timer t;
+    for(int q : queries)
+        sum += fun(q);
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / queries.size() << " ns/lookup"
+              << " (checksum " << sum << ")\n";
+}
+
+void benchmark_many(char const *name, std::vector<int> const &v,
+    std::vector<int> const &queries)
+{
+    std::vector<std::vector<int>::const_iterator> out(queries.size());
+    timer t;
+    ranges::lower_bound_many(v, queries, out.begin());
+    auto ns = t.elapsed().count();
+    long long sum = 0;
+    for(auto it : out)
+        sum += it - v.begin();
+    std::cout << "  " << name << ": " << double(ns) / queries.size() << " ns/lookup"
+              << " (checksum " << sum << ")\n";
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    std::size_t const num_queries = 1u << 22;
+    // 4KB (L1) to 256MB (DRAM) of ints
+    for(std::size_t n = 1u << 10; n <= (1u << 26); n <<= 2)
+    {
+        std::vector<int> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = static_cast<int>(2 * i);
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(2 * n));
+        std::vector<int> queries(num_queries);
+        for(auto &q : queries)
+            q = dist(gen);
+        auto idx = ranges::make_eytzinger_index(v);
+
+        std::cout << n * sizeof(int) / 1024 << "KB:\n";
+        benchmark("std::lower_bound", queries, [&](int q)
+        {
+            return std::lower_bound(v.begin(), v.end(), q) - v.begin();
+        });
+        benchmark("ranges::lower_bound", queries, [&](int q)
+        {
+            return ranges::lower_bound(v, q) - v.begin();
+        });
+        benchmark("eytzinger_index::lower_bound", queries, [&](int q)
+        {
+            auto it = idx.lower_bound(q);
+            return it == idx.sorted().end() ? -1 : *it;
+        });
+        benchmark_many("ranges::lower_bound_many", v, queries);
+        std::sort(queries.begin(), queries.end());
+        benchmark_many("ranges::lower_bound_many (sorted)", v, queries);
+    }
+}
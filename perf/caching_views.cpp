@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares the two caching policies of the views that cache: walking a stride
+// view backward, whose iterators update their offset at every step, and
+// asking a remove_if view for its begin once it has found it.
+
+#include <list>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/remove_if.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, int reps, Fun fun)
+{
+    timer t;
+    long long sum = 0;
+    for(int i = 0; i < reps; ++i)
+        sum += fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / (double(n) * reps) << " ns/step"
+        << " (" << sum << ")\n";
+}
+
+// Sums the elements of rng from the back.
+template<typename Rng>
+long long sum_backward(Rng &&rng)
+{
+    long long sum = 0;
+    auto const first = ranges::begin(rng);
+    auto it = ranges::end(rng);
+    while(it != first)
+        sum += *--it;
+    return sum;
+}
+
+template<typename Cache>
+void run(char const *name)
+{
+    std::size_t const n = std::size_t(1) << 20;
+    std::vector<int> v(n);
+    std::list<int> li;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = int(i % 100);
+        li.push_back(v[i]);
+    }
+    std::cout << name << ":\n";
+    benchmark("vector | stride(3), backward", n / 3, 100, [&]
+    {
+        return sum_backward(ranges::view::stride(v, 3, Cache{}));
+    });
+    auto odd = [](int i) { return i % 2 == 1; };
+    auto evens = li | ranges::view::remove_if(odd);
+    benchmark("list | remove_if | stride(3), backward", n / 6, 10, [&]
+    {
+        return sum_backward(ranges::view::stride(evens, 3, Cache{}));
+    });
+    auto rng = ranges::view::remove_if(v, odd, Cache{});
+    benchmark("remove_if begin, cached", 1, 1 << 24, [&]
+    {
+        return (long long) *ranges::begin(rng);
+    });
+}
+
+int main()
+{
+    run<ranges::single_threaded_cache>("single_threaded_cache");
+    run<ranges::shared_cache>("shared_cache");
+}
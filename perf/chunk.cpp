@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums a vector in blocks of 1024 elements, with an index loop over the
+// blocks, with view::chunk, and with view::group_by on the block number.
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/group_by.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, int reps, Fun fun)
+{
+    timer t;
+    long long sum = 0;
+    for(int i = 0; i < reps; ++i)
+        sum += fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / (double(n) * reps) << " ns/element"
+        << " (" << sum << ")\n";
+}
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 20;
+    std::ptrdiff_t const block = 1024;
+    int const reps = 50;
+    std::vector<int> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = int(i % 100);
+    std::cout << "sum of each block of " << block << ":\n";
+    benchmark("index loop", n, reps, [&]
+    {
+        long long total = 0;
+        for(std::size_t lo = 0; lo < n; lo += block)
+        {
+            std::size_t const hi = (std::min)(lo + std::size_t(block), n);
+            total += ranges::accumulate(v.begin() + lo, v.begin() + hi, 0LL);
+        }
+        return total;
+    });
+    benchmark("view::chunk", n, reps, [&]
+    {
+        long long total = 0;
+        for(auto &&b : v | ranges::view::chunk(block))
+            total += ranges::accumulate(b, 0LL);
+        return total;
+    });
+    int const *const first = v.data();
+    benchmark("view::group_by", n, reps, [&]
+    {
+        long long total = 0;
+        auto same_block = [=](int const &a, int const &b)
+        {
+            return (&a - first) / block == (&b - first) / block;
+        };
+        RANGES_FOR(auto &&b, v | ranges::view::group_by(same_block))
+            total += ranges::accumulate(b, 0LL);
+        return total;
+    });
+}
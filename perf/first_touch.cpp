@@ -0,0 +1,140 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Shows the effect of first-touch page placement on a parallel pass over a
+// freshly allocated buffer. Linux puts each page on the NUMA node of the
+// thread that first writes it, so a buffer initialized by one thread lives on
+// one node, and the threads on the other nodes then read it remotely. The
+// buffer is initialized with the sequential ranges::fill, with the parallel
+// one, and with the parallel one under a pinned policy, and then read by a
+// parallel count_if with the same policy. Unpinned threads can run any chunk
+// on any node, from one call to the next; pinned ones run chunk k of T on
+// node k*N/T every time. The node of each page is queried with the move_pages
+// system call, so that libnuma is not needed.
+//
+// Usage: first_touch [elements]
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/utility/parallel.hpp>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+// For each of the chunks that the parallel algorithms split n elements at p
+// into, the number of its pages on each node, from a sample of up to 256
+// pages per chunk. Empty if the kernel cannot tell.
+std::vector<std::vector<long>> page_nodes(double const *p, std::ptrdiff_t n, std::size_t nodes)
+{
+    std::vector<std::vector<long>> counts;
+#if defined(__linux__) && defined(SYS_move_pages)
+    long const page = sysconf(_SC_PAGESIZE);
+    std::size_t const chunks = ranges::detail::parallel_chunks(ranges::par, n);
+    for(std::size_t k = 0; k < chunks; ++k)
+    {
+        auto const r = ranges::detail::static_chunk(n, chunks, k);
+        char const *lo = reinterpret_cast<char const *>(p + r.first);
+        char const *hi = reinterpret_cast<char const *>(p + r.second);
+        std::ptrdiff_t const step = (std::max)(std::ptrdiff_t(page), (hi - lo) / 256);
+        std::vector<void *> pages;
+        for(char const *q = lo; q < hi; q += step)
+            pages.push_back(const_cast<char *>(q));
+        std::vector<int> status(pages.size(), -1);
+        // With no target nodes, move_pages moves nothing, and reports the
+        // node that each page is on.
+        if(0 != syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr,
+            status.data(), 0))
+            return {};
+        counts.emplace_back(nodes, 0);
+        for(int s : status)
+            if(s >= 0 && static_cast<std::size_t>(s) < nodes)
+                ++counts.back()[static_cast<std::size_t>(s)];
+    }
+#endif
+    return counts;
+}
+
+void run(char const *name, std::ptrdiff_t n, std::size_t nodes, bool parallel_fill,
+    ranges::parallel_policy const &policy)
+{
+    // new double[n] leaves the pages untouched, unlike std::vector<double>(n).
+    std::unique_ptr<double[]> buf(new double[static_cast<std::size_t>(n)]);
+    double *const begin = buf.get(), *const end = begin + n;
+    timer t;
+    if(parallel_fill)
+        ranges::fill(policy, begin, end, 1.0);
+    else
+        ranges::fill(begin, end, 1.0);
+    double const fill_ns = double(t.elapsed().count());
+    t.reset();
+    std::ptrdiff_t count = 0;
+    for(int i = 0; i < 10; ++i)
+        count += ranges::count_if(policy, begin, end, [](double d) { return d > 0.5; });
+    double const pass_ns = double(t.elapsed().count()) / 10;
+    std::cout << name << ": fill " << fill_ns / n << " ns/element, parallel count_if "
+              << pass_ns / n << " ns/element (" << count / 10 << ")\n";
+    auto const counts = page_nodes(begin, n, nodes);
+    for(std::size_t k = 0; k < counts.size(); ++k)
+    {
+        std::cout << "  chunk " << k << " pages by node:";
+        for(long c : counts[k])
+            std::cout << ' ' << c;
+        std::cout << '\n';
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::ptrdiff_t const n = argc > 1 ? std::atol(argv[1]) : std::ptrdiff_t(1) << 27;
+    auto const &nodes = ranges::detail::numa_node_cpus();
+    std::cout << ranges::par.concurrency() << " threads, ";
+    if(nodes.empty())
+        std::cout << "no NUMA topology in sysfs\n";
+    else
+    {
+        std::cout << nodes.size() << " NUMA node(s) with CPUs:";
+        for(std::size_t i = 0; i < nodes.size(); ++i)
+            std::cout << " node" << i << ' ' << nodes[i].size() << " cpus;";
+        std::cout << '\n';
+    }
+    ranges::parallel_policy const pinned{0, true};
+    run("sequential first touch", n, nodes.size(), false, ranges::par);
+    run("parallel first touch, unpinned", n, nodes.size(), true, ranges::par);
+    run("parallel first touch, pinned", n, nodes.size(), true, pinned);
+}
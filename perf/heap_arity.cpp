@@ -0,0 +1,133 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares binary heaps (make_heap/push_heap/pop_heap) with 4-ary and 8-ary
+// heaps, using both the top-down and Floyd's bottom-up pop, on heaps of 1M
+// elements and up. An expensive comparator is simulated by comparing strings
+// with a long common prefix.
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/dary_heap_algorithm.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::milliseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+    friend std::ostream &operator<<(std::ostream &sout, timer const &t)
+    {
+        return sout << t.elapsed().count() << "ms";
+    }
+};
+
+struct binary_heap
+{
+    static char const *name() { return "binary (make_heap)"; }
+    template<typename Rng> static void make(Rng &rng) { ranges::make_heap(rng); }
+    template<typename I> static void push(I b, I e) { ranges::push_heap(b, e); }
+    template<typename I> static void pop(I b, I e) { ranges::pop_heap(b, e); }
+};
+
+template<std::size_t Arity, bool BottomUp>
+struct dary_heap
+{
+    static std::string name()
+    {
+        return std::to_string(Arity) + "-ary" + (BottomUp ? " bottom-up" : "");
+    }
+    template<typename Rng> static void make(Rng &rng) { ranges::make_dary_heap<Arity>(rng); }
+    template<typename I> static void push(I b, I e) { ranges::push_dary_heap<Arity>(b, e); }
+    template<typename I> static void pop(I b, I e)
+    {
+        if(BottomUp)
+            ranges::pop_dary_heap_bottom_up<Arity>(b, e);
+        else
+            ranges::pop_dary_heap<Arity>(b, e);
+    }
+};
+
+// Simulates the operations of a priority queue: build the heap, then do
+// N rounds of pop-the-top followed by push-a-new-element.
+template<typename Heap, typename T>
+void benchmark(std::vector<T> const &input, std::vector<T> const &more)
+{
+    std::vector<T> v = input;
+    timer t;
+    Heap::make(v);
+    auto const make_time = t.elapsed();
+    t.reset();
+    for(auto const &x : more)
+    {
+        Heap::pop(v.begin(), v.end());
+        v.back() = x;
+        Heap::push(v.begin(), v.end());
+    }
+    std::cout << "  " << Heap::name() << ": make " << make_time.count() << "ms, "
+              << more.size() << " pop+push " << t << '\n';
+}
+
+template<typename T>
+void benchmark_all(std::vector<T> const &input, std::vector<T> const &more)
+{
+    benchmark<binary_heap>(input, more);
+    benchmark<dary_heap<2, true>>(input, more);
+    benchmark<dary_heap<4, false>>(input, more);
+    benchmark<dary_heap<4, true>>(input, more);
+    benchmark<dary_heap<8, false>>(input, more);
+    benchmark<dary_heap<8, true>>(input, more);
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    for(std::size_t n : {std::size_t(1) << 20, std::size_t(1) << 22, std::size_t(1) << 24})
+    {
+        std::vector<int> input(n), more(n);
+        std::uniform_int_distribution<int> dist;
+        for(auto &i : input)
+            i = dist(gen);
+        for(auto &i : more)
+            i = dist(gen);
+        std::cout << n << " ints:\n";
+        benchmark_all(input, more);
+    }
+
+    std::size_t const n = std::size_t(1) << 20;
+    std::string const prefix(64, 'x');
+    std::vector<std::string> input(n), more(n);
+    std::uniform_int_distribution<int> dist;
+    for(auto &s : input)
+        s = prefix + std::to_string(dist(gen));
+    for(auto &s : more)
+        s = prefix + std::to_string(dist(gen));
+    std::cout << n << " strings with a common 64 character prefix:\n";
+    benchmark_all(input, more);
+}
@@ -0,0 +1,100 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::partition and std::stable_partition with ranges::partition
+// and ranges::stable_partition, sequential and parallel, on 100M random
+// 32-bit integers split by a threshold, at selectivities from 1% to 99%.
+// Pass a different number of elements as the first argument.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/utility/parallel.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::vector<std::int32_t> const &input,
+    std::vector<std::int32_t> &v, Fun fun)
+{
+    v = input;
+    timer t;
+    auto const mid = fun(v);
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / v.size() << " ns/element"
+              << " (" << (mid - v.begin()) << " true)\n";
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t const n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000000;
+    std::vector<std::int32_t> input(n), v(n);
+    std::mt19937 gen;
+    std::uniform_int_distribution<std::int32_t> dist(0, 99);
+    for(auto &x : input)
+        x = dist(gen);
+    using It = std::vector<std::int32_t>::iterator;
+    for(std::int32_t percent : {1, 10, 50, 90, 99})
+    {
+        auto pred = [=](std::int32_t x) { return x < percent; };
+        std::cout << percent << "% true:\n";
+        benchmark("std::partition", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return std::partition(v.begin(), v.end(), pred);
+        });
+        benchmark("ranges::partition", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return ranges::partition(v, pred);
+        });
+        benchmark("ranges::partition(par)", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return ranges::partition(ranges::par, v, pred);
+        });
+        benchmark("std::stable_partition", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return std::stable_partition(v.begin(), v.end(), pred);
+        });
+        benchmark("ranges::stable_partition", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return ranges::stable_partition(v, pred);
+        });
+        benchmark("ranges::stable_partition(par)", input, v, [&](std::vector<std::int32_t> &v) -> It
+        {
+            return ranges::stable_partition(ranges::par, v, pred);
+        });
+    }
+}
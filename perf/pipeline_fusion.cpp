@@ -0,0 +1,205 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums a vector through 1, 2, 4 and 8 stacked transforms, remove_ifs, drops
+// and reverses, built with the pipe operator, which fuses adjacent adaptors
+// of a kind into one, and built by nesting the view types by hand, which
+// adds an iterator layer per adaptor.
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, int depth, std::size_t n, int reps, Fun fun)
+{
+    timer t;
+    long long sum = 0;
+    for(int i = 0; i < reps; ++i)
+        sum += fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ", depth " << depth << ": "
+        << double(ns) / (double(n) * reps) << " ns/element" << " (" << sum << ")\n";
+}
+
+struct add_one
+{
+    int operator()(int i) const
+    {
+        return i + 1;
+    }
+};
+
+struct is_negative
+{
+    bool operator()(int i) const
+    {
+        return i < 0;
+    }
+};
+
+struct transform_stage
+{
+    static constexpr char const *name = "transform";
+    template<typename Rng>
+    static auto pipe(Rng rng) -> decltype(rng | ranges::view::transform(add_one{}))
+    {
+        return rng | ranges::view::transform(add_one{});
+    }
+    template<typename Rng>
+    static ranges::transform_view<Rng, add_one> nest(Rng rng)
+    {
+        return {std::move(rng), add_one{}};
+    }
+};
+
+struct remove_if_stage
+{
+    static constexpr char const *name = "remove_if";
+    template<typename Rng>
+    static auto pipe(Rng rng) -> decltype(rng | ranges::view::remove_if(is_negative{}))
+    {
+        return rng | ranges::view::remove_if(is_negative{});
+    }
+    template<typename Rng>
+    static ranges::remove_if_view<Rng, is_negative> nest(Rng rng)
+    {
+        return {std::move(rng), is_negative{}};
+    }
+};
+
+struct drop_stage
+{
+    static constexpr char const *name = "drop";
+    template<typename Rng>
+    static auto pipe(Rng rng) -> decltype(rng | ranges::view::drop(1))
+    {
+        return rng | ranges::view::drop(1);
+    }
+    template<typename Rng>
+    static ranges::drop_view<Rng> nest(Rng rng)
+    {
+        return {std::move(rng), 1};
+    }
+};
+
+struct reverse_stage
+{
+    static constexpr char const *name = "reverse";
+    template<typename Rng>
+    static auto pipe(Rng rng) -> decltype(rng | ranges::view::reverse)
+    {
+        return rng | ranges::view::reverse;
+    }
+    template<typename Rng>
+    static ranges::reverse_view<Rng> nest(Rng rng)
+    {
+        return ranges::reverse_view<Rng>{std::move(rng)};
+    }
+};
+
+// Depth stages of a kind, stacked on a range
+template<typename Stage, int Depth>
+struct pipeline
+{
+    using inner = pipeline<Stage, Depth - 1>;
+    template<typename Rng>
+    static auto fused(Rng rng) -> decltype(Stage::pipe(inner::fused(rng)))
+    {
+        return Stage::pipe(inner::fused(std::move(rng)));
+    }
+    template<typename Rng>
+    static auto nested(Rng rng) -> decltype(Stage::nest(inner::nested(rng)))
+    {
+        return Stage::nest(inner::nested(std::move(rng)));
+    }
+};
+
+template<typename Stage>
+struct pipeline<Stage, 0>
+{
+    template<typename Rng>
+    static Rng fused(Rng rng)
+    {
+        return rng;
+    }
+    template<typename Rng>
+    static Rng nested(Rng rng)
+    {
+        return rng;
+    }
+};
+
+template<typename Stage, int Depth>
+void run(std::vector<int> &v, int reps)
+{
+    auto fused = pipeline<Stage, Depth>::fused(ranges::view::all(v));
+    benchmark("fused", Depth, v.size(), reps, [&]
+    {
+        return ranges::accumulate(fused, 0LL);
+    });
+    auto nested = pipeline<Stage, Depth>::nested(ranges::view::all(v));
+    benchmark("nested", Depth, v.size(), reps, [&]
+    {
+        return ranges::accumulate(nested, 0LL);
+    });
+}
+
+template<typename Stage>
+void run_all(std::vector<int> &v, int reps)
+{
+    std::cout << Stage::name << ":\n";
+    run<Stage, 1>(v, reps);
+    run<Stage, 2>(v, reps);
+    run<Stage, 4>(v, reps);
+    run<Stage, 8>(v, reps);
+}
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 20;
+    int const reps = 50;
+    std::vector<int> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = int(i % 100);
+    run_all<transform_stage>(v, reps);
+    run_all<remove_if_stage>(v, reps);
+    run_all<drop_stage>(v, reps);
+    run_all<reverse_stage>(v, reps);
+}
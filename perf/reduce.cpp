@@ -0,0 +1,115 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::count_if, std::min_element and std::minmax_element with the
+// ranges versions, sequential and parallel, on columns of random 32-bit
+// integers and floats. The sequential ranges versions take the vectorized
+// path for contiguous arithmetic elements.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/algorithm/minmax_element.hpp>
+#include <range/v3/utility/parallel.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, Fun fun)
+{
+    timer t;
+    std::size_t const result = fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / n << " ns/element"
+              << " (" << result << ")\n";
+}
+
+template<typename T>
+void run(char const *type, std::vector<T> const &v)
+{
+    auto pred = [](T x) { return x < T(1000); };
+    std::size_t const n = v.size();
+    std::cout << type << ":\n";
+    benchmark("std::count_if", n, [&]
+    {
+        return std::size_t(std::count_if(v.begin(), v.end(), pred));
+    });
+    benchmark("ranges::count_if", n, [&]
+    {
+        return std::size_t(ranges::count_if(v, pred));
+    });
+    benchmark("ranges::count_if(par)", n, [&]
+    {
+        return std::size_t(ranges::count_if(ranges::par, v, pred));
+    });
+    benchmark("std::min_element", n, [&]
+    {
+        return std::size_t(std::min_element(v.begin(), v.end()) - v.begin());
+    });
+    benchmark("ranges::min_element", n, [&]
+    {
+        return std::size_t(ranges::min_element(v) - v.begin());
+    });
+    benchmark("ranges::min_element(par)", n, [&]
+    {
+        return std::size_t(ranges::min_element(ranges::par, v) - v.begin());
+    });
+    benchmark("std::minmax_element", n, [&]
+    {
+        return std::size_t(std::minmax_element(v.begin(), v.end()).second - v.begin());
+    });
+    benchmark("ranges::minmax_element", n, [&]
+    {
+        return std::size_t(ranges::minmax_element(v).second - v.begin());
+    });
+    benchmark("ranges::minmax_element(par)", n, [&]
+    {
+        return std::size_t(ranges::minmax_element(ranges::par, v).second - v.begin());
+    });
+}
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 26;
+    std::mt19937 gen;
+    std::vector<std::int32_t> v(n);
+    std::uniform_int_distribution<std::int32_t> dist(0, 1 << 30);
+    for(auto &x : v)
+        x = dist(gen);
+    run("int32_t", v);
+    std::vector<float> f(v.begin(), v.end());
+    run("float", f);
+}
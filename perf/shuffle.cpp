@@ -0,0 +1,90 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::shuffle with ranges::shuffle, sequential and parallel, on
+// vectors of 32-bit integers sized from L2 cache up to DRAM, with a 32-bit
+// and a 64-bit Mersenne Twister.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/numeric/iota.hpp>
+#include <range/v3/utility/parallel.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::vector<std::uint32_t> &v, Fun fun)
+{
+    ranges::iota(v, 0u);
+    timer t;
+    fun(v);
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / v.size() << " ns/element"
+              << " (first " << v.front() << ")\n";
+}
+
+template<typename Gen>
+void benchmark_gen(char const *gen_name, std::vector<std::uint32_t> &v)
+{
+    std::cout << " " << gen_name << ":\n";
+    benchmark("std::shuffle", v, [](std::vector<std::uint32_t> &v)
+    {
+        Gen g;
+        std::shuffle(v.begin(), v.end(), g);
+    });
+    benchmark("ranges::shuffle", v, [](std::vector<std::uint32_t> &v)
+    {
+        Gen g;
+        ranges::shuffle(v, g);
+    });
+    benchmark("ranges::shuffle(par)", v, [](std::vector<std::uint32_t> &v)
+    {
+        Gen g;
+        ranges::shuffle(ranges::par, v, g);
+    });
+}
+
+int main()
+{
+    for(std::size_t n : {std::size_t(1) << 16, std::size_t(1) << 20, std::size_t(1) << 24,
+        std::size_t(1) << 26})
+    {
+        std::vector<std::uint32_t> v(n);
+        std::cout << n << " elements:\n";
+        benchmark_gen<std::mt19937>("mt19937", v);
+        benchmark_gen<std::mt19937_64>("mt19937_64", v);
+    }
+}
@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Finds the sum and the maximum of each window of 64 elements of a vector,
+// with a loop over each window, with view::sliding, and with sliding_reduce.
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/sliding_reduce.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, int reps, Fun fun)
+{
+    timer t;
+    long long sum = 0;
+    for(int i = 0; i < reps; ++i)
+        sum += fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / (double(n) * reps) << " ns/element"
+        << " (" << sum << ")\n";
+}
+
+struct max_fn
+{
+    long long operator()(long long a, long long b) const
+    {
+        return (std::max)(a, b);
+    }
+};
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 20;
+    std::ptrdiff_t const window = 64;
+    int const reps = 10;
+    std::vector<long long> v(n), out(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = (long long)((i * 7919) % 1000);
+    std::cout << "sum of each window of " << window << ":\n";
+    benchmark("loop over each window", n, reps, [&]
+    {
+        long long total = 0;
+        for(std::size_t i = 0; i + window <= n; ++i)
+            total += ranges::accumulate(v.begin() + i, v.begin() + i + window, 0LL);
+        return total;
+    });
+    benchmark("view::sliding", n, reps, [&]
+    {
+        long long total = 0;
+        for(auto &&w : v | ranges::view::sliding(window))
+            total += ranges::accumulate(w, 0LL);
+        return total;
+    });
+    benchmark("sliding_reduce with inverse", n, reps, [&]
+    {
+        auto end = ranges::sliding_reduce(v, window, out.begin(), ranges::plus{},
+            ranges::minus{}).second;
+        return ranges::accumulate(out.begin(), end, 0LL);
+    });
+    benchmark("sliding_reduce", n, reps, [&]
+    {
+        auto end = ranges::sliding_reduce(v, window, out.begin(), ranges::plus{}).second;
+        return ranges::accumulate(out.begin(), end, 0LL);
+    });
+    std::cout << "maximum of each window of " << window << ":\n";
+    benchmark("loop over each window", n, reps, [&]
+    {
+        long long total = 0;
+        for(std::size_t i = 0; i + window <= n; ++i)
+            total += *std::max_element(v.begin() + i, v.begin() + i + window);
+        return total;
+    });
+    benchmark("sliding_reduce", n, reps, [&]
+    {
+        auto end = ranges::sliding_reduce(v, window, out.begin(), max_fn{}).second;
+        return ranges::accumulate(out.begin(), end, 0LL);
+    });
+}
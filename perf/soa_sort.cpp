@@ -0,0 +1,135 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sorts rows of an int key and two payload columns by key, stored as an array
+// of structs, as three vectors glued with view::zip, and as a soa_vector; and
+// sorts the three vectors with sort_permute, which sorts the keys alone and
+// then gathers each payload column once.
+
+#include <tuple>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/sort_permute.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+struct row
+{
+    int key;
+    float x;
+    double y;
+};
+
+struct first_fn
+{
+    template<typename T>
+    auto operator()(T &&t) const -> decltype(std::get<0>(t))
+    {
+        return std::get<0>(t);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, Fun fun)
+{
+    timer t;
+    fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / n << " ns/element\n";
+}
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 21;
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist;
+    std::vector<int> keys(n);
+    for(auto &k : keys)
+        k = dist(gen);
+
+    for(bool stable : {false, true})
+    {
+        std::cout << (stable ? "stable_sort" : "sort") << " by key:\n";
+        std::vector<row> aos(n);
+        std::vector<int> k(n);
+        std::vector<float> x(n);
+        std::vector<double> y(n);
+        std::vector<int> pk(n);
+        std::vector<float> px(n);
+        std::vector<double> py(n);
+        ranges::soa_vector<int, float, double> soa;
+        soa.reserve(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            aos[i] = row{keys[i], float(i), double(i)};
+            k[i] = keys[i];
+            x[i] = float(i);
+            y[i] = double(i);
+            pk[i] = keys[i];
+            px[i] = float(i);
+            py[i] = double(i);
+            soa.emplace_back(keys[i], float(i), double(i));
+        }
+        auto zip = ranges::view::zip(k, x, y);
+        benchmark("array of structs", n, [&]
+        {
+            if(stable)
+                ranges::stable_sort(aos, std::less<int>(), &row::key);
+            else
+                ranges::sort(aos, std::less<int>(), &row::key);
+        });
+        benchmark("view::zip", n, [&]
+        {
+            if(stable)
+                ranges::stable_sort(zip, std::less<int>(), first_fn());
+            else
+                ranges::sort(zip, std::less<int>(), first_fn());
+        });
+        benchmark("soa_vector", n, [&]
+        {
+            if(stable)
+                ranges::stable_sort(soa, std::less<int>(), first_fn());
+            else
+                ranges::sort(soa, std::less<int>(), first_fn());
+        });
+        if(!stable)
+            benchmark("sort_permute", n, [&]
+            {
+                ranges::sort_permute(pk, px, py);
+            });
+    }
+}
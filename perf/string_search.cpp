@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares std::search and the searchers in range/v3/algorithm/searchers.hpp
+// when looking for patterns of several lengths near the end of a large buffer
+// of English-like text and of a low-entropy (four letter) alphabet.
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/search.hpp>
+#include <range/v3/algorithm/searchers.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::string const &text, Fun fun)
+{
+    timer t;
+    auto pos = fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(text.size()) / ns << " GB/s"
+              << " (found at " << pos << ")\n";
+}
+
+void run(char const *title, std::string const &alphabet)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> dist(0, alphabet.size() - 1);
+    std::string text(1u << 26, ' ');
+    for(auto &c : text)
+        c = alphabet[dist(gen)];
+    for(std::size_t m : {8u, 64u, 4096u})
+    {
+        std::string const pat = text.substr(text.size() - m - 1000, m);
+        std::cout << title << ", pattern of " << m << " bytes:\n";
+        benchmark("std::search", text, [&]
+        {
+            return std::search(text.begin(), text.end(), pat.begin(), pat.end()) - text.begin();
+        });
+        auto dflt = ranges::make_default_searcher(pat);
+        benchmark("default_searcher", text, [&]
+        {
+            return ranges::search(text, dflt) - text.begin();
+        });
+        auto bmh = ranges::make_boyer_moore_horspool_searcher(pat);
+        benchmark("boyer_moore_horspool_searcher", text, [&]
+        {
+            return ranges::search(text, bmh) - text.begin();
+        });
+        auto tw = ranges::make_two_way_searcher(pat);
+        benchmark("two_way_searcher", text, [&]
+        {
+            return ranges::search(text, tw) - text.begin();
+        });
+    }
+}
+
+int main()
+{
+    run("Text", "abcdefghijklmnopqrstuvwxyz      eeeettaaooiinnsshhrr");
+    run("DNA", "ACGT");
+}
@@ -0,0 +1,79 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares an indexed loop over three columns with the same loop written over
+// view::zip of them. The columns are sized and random-access, so the zip
+// iterates with a single shared index and the loop vectorizes like the
+// hand-written one.
+
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <range/v3/core.hpp>
+#include <range/v3/view/zip.hpp>
+
+class timer
+{
+private:
+    std::chrono::high_resolution_clock::time_point start_;
+public:
+    timer()
+    {
+        reset();
+    }
+    void reset()
+    {
+        start_ = std::chrono::high_resolution_clock::now();
+    }
+    std::chrono::nanoseconds elapsed() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start_);
+    }
+};
+
+template<typename Fun>
+void benchmark(char const *name, std::size_t n, int reps, Fun fun)
+{
+    timer t;
+    for(int i = 0; i < reps; ++i)
+        fun();
+    auto ns = t.elapsed().count();
+    std::cout << "  " << name << ": " << double(ns) / (double(n) * reps) << " ns/element\n";
+}
+
+int main()
+{
+    std::size_t const n = std::size_t(1) << 16;
+    int const reps = 2000;
+    std::vector<float> a(n), b(n), c(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = float(i % 100);
+        b[i] = float(i % 7);
+    }
+    std::cout << "c = a * b + c:\n";
+    benchmark("index loop", n, reps, [&]
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            c[i] = a[i] * b[i] + c[i];
+    });
+    benchmark("view::zip", n, reps, [&]
+    {
+        for(auto &&t : ranges::view::zip(a, b, c))
+            std::get<2>(t) = std::get<0>(t) * std::get<1>(t) + std::get<2>(t);
+    });
+    double sum = 0;
+    for(float f : c)
+        sum += f;
+    std::cout << "  (" << sum << ")\n";
+}
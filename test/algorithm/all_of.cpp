@@ -12,7 +12,10 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
+#include "../test_utils.hpp"
 
 bool even(int n) { return n % 2 == 0; }
 
@@ -56,5 +59,29 @@ int main()
   CHECK(!ranges::all_of({S(false), S(true), S(false)}, &S::p));
   CHECK(!ranges::all_of({S(false), S(false), S(false)}, &S::p));
 
+  {
+    std::vector<int> big(100000, 2);
+    for(std::size_t threads : {1u, 3u, 8u})
+    {
+      ranges::parallel_policy const policy{threads};
+      CHECK(ranges::all_of(policy, big, even));
+      big[99999] = 1;
+      CHECK(!ranges::all_of(policy, big.begin(), big.end(), even));
+      big[99999] = 2;
+      big[17] = 1;
+      CHECK(!ranges::all_of(policy, big, even));
+      big[17] = 2;
+    }
+    CHECK(ranges::all_of(ranges::par, all_true, &S::p));
+    CHECK(!ranges::all_of(ranges::par, one_true, &S::p));
+  }
+
+  // Over view::zip
+  {
+    std::vector<int> k(100000, 2), v(100000, 0);
+    k[70000] = 1;
+    CHECK(!ranges::all_of(ranges::parallel_policy{3}, ranges::view::zip(k, v), first_is_even()));
+  }
+
   return ::test_result();
 }
@@ -0,0 +1,137 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i & 1;
+    }
+};
+
+struct first_is_odd
+{
+    template<typename P>
+    bool operator()(P const &p) const
+    {
+        return p.first & 1;
+    }
+};
+
+struct S
+{
+    int i;
+};
+
+template<typename I, typename O>
+void test()
+{
+    int const ia[] = {1, 2, 3, 4, 6, 8, 5, 7};
+    int ib[8] = {0};
+    std::pair<I, O> r = ranges::copy_if(I(ia), I(ia + 8), O(ib), is_odd());
+    CHECK(base(r.first) == ia + 8);
+    CHECK(base(r.second) == ib + 4);
+    ::check_equal(ranges::make_range(ib, ib + 4), {1, 3, 5, 7});
+}
+
+int main()
+{
+    test<input_iterator<int const *>, output_iterator<int *>>();
+    test<forward_iterator<int const *>, int *>();
+    test<random_access_iterator<int const *>, random_access_iterator<int *>>();
+    test<int const *, output_iterator<int *>>();
+    test<int const *, int *>();
+
+    // Check projection
+    {
+        S ia[] = {S{1}, S{2}, S{3}, S{4}};
+        S ib[4];
+        std::pair<S *, S *> r = ranges::copy_if(ia, ib, is_odd(), &S::i);
+        CHECK(r.first == ia + 4);
+        CHECK(r.second == ib + 2);
+        CHECK(ib[0].i == 1);
+        CHECK(ib[1].i == 3);
+    }
+
+    // Contiguous arithmetic elements take a branch-free path, and the parallel
+    // overloads split the work into chunks; all give the same result.
+    for(int n : {0, 1, 63, 64, 65, 129, 100003})
+    {
+        std::vector<float> v(n);
+        for(int i = 0; i < n; ++i)
+            v[i] = static_cast<float>(i % 17);
+        auto pred = [](float f) { return f > 8.5f; };
+        std::vector<float> expected;
+        for(float f : v)
+            if(pred(f))
+                expected.push_back(f);
+
+        std::vector<float> out(n, -1.f);
+        auto r = ranges::copy_if(v, out.begin(), pred);
+        CHECK(r.first == v.end());
+        CHECK((r.second - out.begin()) == (std::ptrdiff_t)expected.size());
+        CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+
+        for(std::size_t threads : {1, 2, 7})
+        {
+            std::vector<float> out2(n, -1.f);
+            auto r2 = ranges::copy_if(ranges::parallel_policy{threads}, v.begin(), v.end(),
+                out2.data(), pred);
+            CHECK(r2.first == v.end());
+            CHECK(r2.second == out2.data() + expected.size());
+            CHECK(out2 == out);
+        }
+    }
+
+    // vector<bool> packs its elements into bits, so is not copied as bytes.
+    {
+        std::vector<bool> v = {true, false, true, true, false};
+        std::vector<bool> out(5, false);
+        auto r = ranges::copy_if(v, out.begin(), [](bool b) { return !b; });
+        CHECK((r.second - out.begin()) == 2);
+        CHECK((!out[0] && !out[1] && !out[2]));
+    }
+
+    // Zipped elements are proxies, and reach the predicate as the zip's
+    // reference type.
+    {
+        std::vector<int> k(100003), v(100003);
+        std::vector<std::pair<int, int>> expected;
+        for(int i = 0; i < 100003; ++i)
+        {
+            k[i] = i % 17;
+            v[i] = i;
+            if(k[i] & 1)
+                expected.emplace_back(k[i], i);
+        }
+        auto z = ranges::view::zip(k, v);
+        for(std::size_t threads : {1, 2, 7})
+        {
+            std::vector<std::pair<int, int>> out(100003);
+            auto r = ranges::copy_if(ranges::parallel_policy{threads}, z, out.begin(),
+                first_is_odd());
+            CHECK((r.second - out.begin()) == (std::ptrdiff_t)expected.size());
+            CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+        }
+    }
+
+    return ::test_result();
+}
@@ -9,8 +9,10 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -57,5 +59,20 @@ int main()
     CHECK(count(make_range(input_iterator<const S*>(sa),
                       sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    // Contiguous arithmetic elements are counted in vectorizable lanes, and
+    // the parallel overloads sum the counts of chunks; all agree.
+    for(int n : {0, 15, 16, 17, 1000, 70000, 100003})
+    {
+        std::vector<int> v(n);
+        for(int i = 0; i < n; ++i)
+            v[i] = i % 13;
+        std::ptrdiff_t const expected = n / 13 + (n % 13 > 5);
+        CHECK(count(v, 5) == expected);
+        CHECK(count(v.data(), v.data() + n, 5) == expected);
+        for(std::size_t threads : {1u, 3u, 8u})
+            CHECK(count(parallel_policy{threads}, v, 5) == expected);
+    }
+    CHECK(count(par, sa, 2, &S::i) == 3);
+
     return ::test_result();
 }
@@ -9,8 +9,10 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -74,5 +76,23 @@ int main()
     CHECK(count_if(make_range(input_iterator<T*>(ta),
                          sentinel<T*>(ta + size(ta))), &T::b) == 4);
 
+    // Contiguous arithmetic elements are counted in vectorizable lanes, and
+    // the parallel overloads sum the counts of chunks; all agree.
+    for(int n : {0, 15, 16, 17, 1000, 70000, 100003})
+    {
+        std::vector<float> v(n);
+        for(int i = 0; i < n; ++i)
+            v[i] = static_cast<float>(i % 13);
+        auto pred = [](float f) { return f < 4.5f; };
+        std::ptrdiff_t expected = 0;
+        for(float f : v)
+            expected += pred(f);
+        CHECK(count_if(v, pred) == expected);
+        CHECK(count_if(v.data(), v.data() + n, pred) == expected);
+        for(std::size_t threads : {1u, 3u, 8u})
+            CHECK(count_if(parallel_policy{threads}, v, pred) == expected);
+    }
+    CHECK(count_if(par, sa, equals(2), &S::i) == 3);
+
     return ::test_result();
 }
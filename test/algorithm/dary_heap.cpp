@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/dary_heap_algorithm.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct S
+{
+    int i;
+};
+
+template<std::size_t Arity>
+void test(int N)
+{
+    std::vector<int> v(N);
+    for(int i = 0; i < N; ++i)
+        v[i] = i;
+    std::random_shuffle(v.begin(), v.end());
+
+    CHECK(ranges::make_dary_heap<Arity>(v) == v.end());
+    CHECK(ranges::is_dary_heap<Arity>(v));
+    CHECK(ranges::is_dary_heap_until<Arity>(v) == v.end());
+    if(N > 0)
+        CHECK(v[0] == N - 1);
+
+    // push every element back in one at a time
+    std::random_shuffle(v.begin(), v.end());
+    for(int i = 1; i <= N; ++i)
+    {
+        CHECK(ranges::push_dary_heap<Arity>(v.begin(), v.begin() + i) == v.begin() + i);
+        CHECK(ranges::is_dary_heap<Arity>(v.begin(), v.begin() + i));
+    }
+
+    // pop them off in descending order, alternating the two pop strategies
+    for(int i = N; i > 0; --i)
+    {
+        CHECK(v[0] == i - 1);
+        if(i % 2)
+            ranges::pop_dary_heap<Arity>(v.begin(), v.begin() + i);
+        else
+            ranges::pop_dary_heap_bottom_up<Arity>(v.begin(), v.begin() + i);
+        CHECK(v[i - 1] == i - 1);
+        CHECK(ranges::is_dary_heap<Arity>(v.begin(), v.begin() + (i - 1)));
+    }
+
+    std::random_shuffle(v.begin(), v.end());
+    ranges::make_dary_heap<Arity>(v, std::greater<int>());
+    CHECK(ranges::sort_dary_heap<Arity>(v, std::greater<int>()) == v.end());
+    CHECK(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+}
+
+int main()
+{
+    test<2>(0);
+    test<2>(1);
+    test<2>(100);
+    test<3>(100);
+    test<4>(1);
+    test<4>(2);
+    test<4>(1000);
+    test<8>(1000);
+    test<8>(9);
+
+    // A binary d-ary heap has the same layout as make_heap's.
+    std::vector<int> v(257);
+    for(int i = 0; i < 257; ++i)
+        v[i] = (i * 37) % 257;
+    ranges::make_dary_heap<2>(v);
+    CHECK(ranges::is_heap(v));
+
+    // Not a heap
+    int ia[] = {1, 2, 3, 4, 5};
+    CHECK(!ranges::is_dary_heap<4>(ia));
+    CHECK(ranges::is_dary_heap_until<4>(ia) == ia + 1);
+    CHECK(ranges::is_dary_heap_until<4>(ia, std::greater<int>()) == ia + 5);
+
+    // Projections
+    S sa[] = {{3}, {1}, {4}, {1}, {5}, {9}, {2}, {6}};
+    ranges::make_dary_heap<4>(sa, std::less<int>(), &S::i);
+    CHECK(ranges::is_dary_heap<4>(sa, std::less<int>(), &S::i));
+    CHECK(sa[0].i == 9);
+    ranges::pop_dary_heap_bottom_up<4>(sa, std::less<int>(), &S::i);
+    CHECK(sa[7].i == 9);
+    CHECK(sa[0].i == 6);
+    CHECK(ranges::is_dary_heap<4>(sa, sa + 7, std::less<int>(), &S::i));
+
+    return ::test_result();
+}
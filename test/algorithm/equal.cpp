@@ -18,11 +18,15 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/unbounded.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
+#include "../test_utils.hpp"
 
 void test()
 {
@@ -276,10 +280,34 @@ int main()
     ::test_pred();
     ::test_rng_pred();
 
-    int *p = nullptr;
-    static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, p))>::value, "");
-    static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, {1, 2, 3, 4}))>::value, "");
-    static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, ranges::view::unbounded(p)))>::value, "");
+    // Parallel comparisons
+    {
+        std::vector<int> a(100000), b(100000);
+        for(int i = 0; i < 100000; ++i)
+            a[i] = b[i] = i;
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            CHECK(ranges::equal(policy, a, b));
+            CHECK(ranges::equal(policy, a.begin(), a.end(), b.begin()));
+            CHECK(!ranges::equal(policy, a.begin(), a.end(), b.begin(), b.end() - 1));
+            b[99999] = 0;
+            CHECK(!ranges::equal(policy, a, b));
+            CHECK(ranges::equal(policy, a.begin(), a.end() - 1, b.begin(), b.end() - 1));
+            b[99999] = 99999;
+            CHECK(ranges::equal(policy, a, b, [](int x, int y) { return x == y; }));
+        }
+    }
+
+    // Over view::zip
+    {
+        std::vector<int> a(100000), b(100000), v(100000, 0);
+        for(int i = 0; i < 100000; ++i)
+            a[i] = b[i] = i;
+        b[60000] = -1;
+        CHECK(!ranges::equal(ranges::parallel_policy{3}, ranges::view::zip(a, v),
+            ranges::view::zip(b, v), firsts_equal()));
+    }
 
     return ::test_result();
 }
@@ -19,10 +19,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <cstring>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/fill_n.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -67,6 +70,30 @@ test_int()
     CHECK(ia[3] == 2);
 }
 
+void test_parallel()
+{
+    // Every chunk is filled, however many threads there are.
+    for(int n : {0, 1, 1000, 70000, 100003})
+    {
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            std::vector<int> v(n, 0);
+            CHECK(ranges::fill(policy, v, 1) == v.end());
+            CHECK(std::count(v.begin(), v.end(), 1) == n);
+            CHECK(ranges::fill(policy, v.begin(), v.end(), 2) == v.end());
+            CHECK(std::count(v.begin(), v.end(), 2) == n);
+            CHECK(ranges::fill_n(policy, v.begin(), n / 2, 3) == v.begin() + n / 2);
+            CHECK(std::count(v.begin(), v.end(), 3) == n / 2);
+            CHECK(std::count(v.begin() + n / 2, v.end(), 2) == (n - n / 2));
+        }
+    }
+    int ia[4] = {0};
+    CHECK(ranges::fill(ranges::par, random_access_iterator<int*>(ia),
+        sentinel<int*>(ia + 4), 5) == random_access_iterator<int*>(ia + 4));
+    CHECK((ia[0] == 5 && ia[3] == 5));
+}
+
 int main()
 {
     test_char<forward_iterator<char*> >();
@@ -87,5 +114,7 @@ int main()
     test_int<bidirectional_iterator<int*>, sentinel<int*> >();
     test_int<random_access_iterator<int*>, sentinel<int*> >();
 
+    test_parallel();
+
     return ::test_result();
 }
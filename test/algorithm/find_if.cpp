@@ -19,10 +19,15 @@
 //===----------------------------------------------------------------------===//
 
 #include <utility>
+#include <vector>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
+#include "../test_utils.hpp"
 
 struct S
 {
@@ -64,5 +69,58 @@ int main()
     ps = find_if(sa, [](int i){return i == 10;}, &S::i_);
     CHECK(ps == end(sa));
 
+    // The parallel overloads find the first match, whatever the number of
+    // threads, and wherever the others are.
+    {
+        int const n = 200000;
+        std::vector<int> v(n, 0);
+        for(int at : {0, 4095, 4096, 77777, n - 1, n})
+        {
+            if(at < n)
+                v[at] = 1;
+            if(at + 5000 < n)
+                v[at + 5000] = 1;
+            v[n - 1] = 1 - (at == n);
+            int const expected = at == n ? n : at;
+            for(std::size_t threads : {1u, 3u, 8u})
+            {
+                auto r = find_if(parallel_policy{threads}, v, [](int i){return i == 1;});
+                CHECK((r - v.begin()) == expected);
+            }
+            CHECK((find_if(par, v.begin(), v.end(), [](int i){return i == 1;}) - v.begin()) ==
+                expected);
+            std::fill(v.begin(), v.end(), 0);
+        }
+        std::vector<S> vs(n, S{0});
+        vs[150000].i_ = 3;
+        CHECK((find_if(parallel_policy{4}, vs, [](int i){return i == 3;}, &S::i_) - vs.begin()) ==
+            150000);
+        CHECK(find_if(par, sa, [](int i){return i == 3;}, &S::i_) == sa + 3);
+    }
+
+    // An exception thrown by the predicate reaches the caller.
+    {
+        std::vector<int> v(100000, 0);
+        v[60000] = -1;
+        bool caught = false;
+        try
+        {
+            find_if(parallel_policy{4}, v, [](int i){ if(i < 0) throw i; return false; });
+        }
+        catch(int)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+    }
+
+    // Over view::zip
+    {
+        std::vector<int> k(100000, 1), v(100000, 0);
+        k[70000] = 0;
+        auto z = view::zip(k, v);
+        CHECK((find_if(parallel_policy{3}, z, first_is_even()) - begin(z)) == 70000);
+    }
+
     return ::test_result();
 }
@@ -18,14 +18,25 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <atomic>
 #include <vector>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/view/counted.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+struct index_gen
+{
+    int base_;
+    int calls_;
+    index_gen(int base) : base_(base), calls_(0) {}
+    int operator()(std::ptrdiff_t i) {++calls_; return base_ + static_cast<int>(i);}
+};
+
 struct gen_test
 {
     int i_;
@@ -72,6 +83,54 @@ void test2()
     CHECK(v[4] == 5);
 }
 
+void test_parallel()
+{
+    // Each element is set to the generator called with its index, however
+    // the range is split.
+    for(int n : {0, 1, 1000, 70000, 100003})
+    {
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            std::vector<int> v(n, -1);
+            std::atomic<int> calls(0);
+            auto gen = [&calls](std::ptrdiff_t i) { ++calls; return int(i * 3 % 1009); };
+            auto res = ranges::generate(policy, v.begin(), v.end(), gen);
+            CHECK(res.first == v.end());
+            CHECK(calls == n);
+            for(int j = 0; j < n; ++j)
+                if(v[j] != j * 3 % 1009)
+                {
+                    CHECK(v[j] == j * 3 % 1009);
+                    break;
+                }
+            std::fill(v.begin(), v.end(), -1);
+            CHECK(ranges::generate(policy, v, gen).first == v.end());
+            CHECK(calls == 2 * n);
+            CHECK(std::count(v.begin(), v.end(), -1) == 0);
+        }
+    }
+
+    // Each chunk calls its own copy of a stateful generator, and the one
+    // returned is untouched. The result depends only on the indices.
+    {
+        int const n = 100003;
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            std::vector<int> v(n, 0);
+            auto res = ranges::generate(ranges::parallel_policy{threads}, v, index_gen(1));
+            CHECK(res.first == v.end());
+            CHECK(res.second.calls_ == 0);
+            for(int j = 0; j < n; ++j)
+                if(v[j] != j + 1)
+                {
+                    CHECK(v[j] == j + 1);
+                    break;
+                }
+        }
+    }
+}
+
 int main()
 {
     test<forward_iterator<int*> >();
@@ -84,6 +143,7 @@ int main()
     test<random_access_iterator<int*>, sentinel<int*> >();
 
     test2();
+    test_parallel();
 
     return ::test_result();
 }
@@ -18,13 +18,24 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <atomic>
 #include <vector>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/generate_n.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+struct index_gen
+{
+    int base_;
+    int calls_;
+    index_gen(int base) : base_(base), calls_(0) {}
+    int operator()(std::ptrdiff_t i) {++calls_; return base_ + static_cast<int>(i);}
+};
+
 struct gen_test
 {
     int i_;
@@ -81,6 +92,50 @@ void test2()
     CHECK(v[4] == 5);
 }
 
+void test_parallel()
+{
+    // Each element is set to the generator called with its index, however
+    // the range is split.
+    for(int n : {0, 1, 1000, 70000, 100003})
+    {
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            std::vector<int> v(n, -1);
+            std::atomic<int> calls(0);
+            auto gen = [&calls](std::ptrdiff_t i) { ++calls; return int(i * 3 % 1009); };
+            auto res = ranges::generate_n(policy, v.begin(), n, gen);
+            CHECK(res.first == v.end());
+            CHECK(calls == n);
+            for(int j = 0; j < n; ++j)
+                if(v[j] != j * 3 % 1009)
+                {
+                    CHECK(v[j] == j * 3 % 1009);
+                    break;
+                }
+        }
+    }
+
+    // Each chunk calls its own copy of a stateful generator, and the one
+    // returned is untouched. The result depends only on the indices.
+    {
+        int const n = 100003;
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            std::vector<int> v(n, 0);
+            auto res = ranges::generate_n(ranges::parallel_policy{threads}, v.begin(), n, index_gen(1));
+            CHECK(res.first == v.end());
+            CHECK(res.second.calls_ == 0);
+            for(int j = 0; j < n; ++j)
+                if(v[j] != j + 1)
+                {
+                    CHECK(v[j] == j + 1);
+                    break;
+                }
+        }
+    }
+}
+
 int main()
 {
     test<forward_iterator<int*> >();
@@ -93,6 +148,7 @@ int main()
     test<random_access_iterator<int*>, sentinel<int*> >();
 
     test2();
+    test_parallel();
 
     return ::test_result();
 }
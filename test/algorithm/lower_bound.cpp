@@ -16,6 +16,7 @@
 #include <utility>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/view/zip.hpp>
 #include "../simple_test.hpp"
 
 int main()
@@ -45,5 +46,13 @@ int main()
     CHECK(ranges::lower_bound(a, 1, less(), &std::pair<int, int>::first) == &a[2]);
     CHECK(ranges::lower_bound(c, 1, less(), &std::pair<int, int>::first) == &c[2]);
 
+    // Elements of a zip are read through proxies.
+    {
+        int k[] = {0, 0, 1, 1, 3, 3};
+        int v[] = {0, 1, 2, 3, 4, 5};
+        auto z = ranges::view::zip(k, v);
+        CHECK((ranges::lower_bound(z, std::make_pair(1, 2)) - begin(z)) == 2);
+    }
+
     return test_result();
 }
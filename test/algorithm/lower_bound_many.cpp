@@ -0,0 +1,163 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <random>
+#include <utility>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/lower_bound_many.hpp>
+#include <range/v3/algorithm/equal_range_many.hpp>
+#include <range/v3/view/zip.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+namespace
+{
+    void check_against_std(std::vector<int> const &hay, std::vector<int> const &qs)
+    {
+        std::vector<std::vector<int>::const_iterator> lbs(qs.size());
+        auto res = ranges::lower_bound_many(hay, qs, lbs.begin());
+        CHECK(res.first == qs.end());
+        CHECK(res.second == lbs.end());
+        std::vector<ranges::range<std::vector<int>::const_iterator>> ers(qs.size());
+        auto res2 = ranges::equal_range_many(hay, qs, ers.begin());
+        CHECK(res2.first == qs.end());
+        CHECK(res2.second == ers.end());
+        for(std::size_t i = 0; i < qs.size(); ++i)
+        {
+            CHECK(lbs[i] == std::lower_bound(hay.begin(), hay.end(), qs[i]));
+            auto er = std::equal_range(hay.begin(), hay.end(), qs[i]);
+            CHECK(ers[i].begin() == er.first);
+            CHECK(ers[i].end() == er.second);
+        }
+    }
+}
+
+int main()
+{
+    using ranges::less;
+
+    // Small cases, sorted and unsorted queries
+    {
+        int a[] = {0, 1, 1, 3, 3, 3, 7, 9};
+        int q[] = {-1, 1, 3, 4, 9, 10};
+        int *out[6];
+        auto res = ranges::lower_bound_many(a, q, out);
+        CHECK(res.first == ranges::end(q));
+        CHECK(res.second == ranges::end(out));
+        CHECK(out[0] == &a[0]);
+        CHECK(out[1] == &a[1]);
+        CHECK(out[2] == &a[3]);
+        CHECK(out[3] == &a[6]);
+        CHECK(out[4] == &a[7]);
+        CHECK(out[5] == &a[8]);
+
+        int u[] = {9, 1, 10, -1, 3};
+        ranges::lower_bound_many(a, u, out);
+        CHECK(out[0] == &a[7]);
+        CHECK(out[1] == &a[1]);
+        CHECK(out[2] == &a[8]);
+        CHECK(out[3] == &a[0]);
+        CHECK(out[4] == &a[3]);
+
+        ranges::range<int *> rs[3];
+        ranges::equal_range_many(a, {3, 2, 1}, rs);
+        CHECK(rs[0].begin() == &a[3]);
+        CHECK(rs[0].end() == &a[6]);
+        CHECK(rs[1].begin() == &a[3]);
+        CHECK(rs[1].end() == &a[3]);
+        CHECK(rs[2].begin() == &a[1]);
+        CHECK(rs[2].end() == &a[3]);
+    }
+
+    // Queries from a single-pass range
+    {
+        int a[] = {0, 2, 4, 6, 8};
+        int q[] = {1, 5, 8};
+        int *out[3];
+        auto res = ranges::lower_bound_many(a, a + 5, input_iterator<int *>(q),
+            sentinel<int *>(q + 3), out);
+        CHECK(res.first.base() == q + 3);
+        CHECK(out[0] == &a[1]);
+        CHECK(out[1] == &a[3]);
+        CHECK(out[2] == &a[4]);
+    }
+
+    // Projections and predicates
+    {
+        std::pair<int, int> a[] = {{0, 0}, {0, 1}, {1, 2}, {1, 3}, {3, 4}, {3, 5}};
+        std::pair<int, int> *out[3];
+        ranges::lower_bound_many(a, {3, 1, 2}, out, less(), &std::pair<int, int>::first);
+        CHECK(out[0] == &a[4]);
+        CHECK(out[1] == &a[2]);
+        CHECK(out[2] == &a[4]);
+
+        int d[] = {9, 7, 7, 3, 0};
+        ranges::range<int *> rs[2];
+        ranges::equal_range_many(d, {7, 3}, rs, std::greater<int>());
+        CHECK(rs[0].begin() == &d[1]);
+        CHECK(rs[0].end() == &d[3]);
+        CHECK(rs[1].begin() == &d[3]);
+        CHECK(rs[1].end() == &d[4]);
+    }
+
+    // Empty haystack and empty queries
+    {
+        std::vector<int> hay;
+        check_against_std(hay, {});
+        check_against_std(hay, {1, 2, 3});
+        check_against_std({1, 2, 3}, {});
+    }
+
+    // Many queries, spanning several batches, in every order
+    {
+        std::mt19937 gen;
+        std::vector<int> hay(1000);
+        std::uniform_int_distribution<int> dist(0, 2000);
+        for(auto &i : hay)
+            i = dist(gen);
+        std::sort(hay.begin(), hay.end());
+        std::vector<int> qs(100);
+        std::uniform_int_distribution<int> qdist(-10, 2010);
+        for(auto &i : qs)
+            i = qdist(gen);
+        check_against_std(hay, qs);
+        std::sort(qs.begin(), qs.end());
+        check_against_std(hay, qs);
+        std::reverse(qs.begin(), qs.end());
+        check_against_std(hay, qs);
+        // Sorted batches that restart lower than the previous batch
+        std::sort(qs.begin(), qs.begin() + 50);
+        std::sort(qs.begin() + 50, qs.end());
+        check_against_std(hay, qs);
+    }
+
+    // A zipped haystack, whose elements are proxies, searched both by
+    // galloping and by interleaved searches
+    {
+        int k[] = {0, 0, 1, 1, 3, 3};
+        int v[] = {0, 1, 2, 3, 4, 5};
+        auto z = ranges::view::zip(k, v);
+        using P = std::pair<int, int>;
+        ranges::range_iterator_t<decltype(z)> out[3];
+        ranges::lower_bound_many(z, {P{1, 2}, P{1, 3}, P{3, 0}}, out);
+        CHECK((out[0] - ranges::begin(z)) == 2);
+        CHECK((out[1] - ranges::begin(z)) == 3);
+        CHECK((out[2] - ranges::begin(z)) == 4);
+        ranges::lower_bound_many(z, {P{3, 0}, P{0, 1}, P{1, 3}}, out);
+        CHECK((out[0] - ranges::begin(z)) == 4);
+        CHECK((out[1] - ranges::begin(z)) == 1);
+        CHECK((out[2] - ranges::begin(z)) == 3);
+    }
+
+    return test_result();
+}
@@ -21,8 +21,12 @@
 #include <memory>
 #include <numeric>
 #include <algorithm>
+#include <limits>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -119,6 +123,53 @@ test_iter_comp()
     test_iter_comp<Iter, Sent>(1000);
 }
 
+// The vectorized path for contiguous arithmetic elements, and the parallel
+// overloads, find the same element as the search one element at a time.
+template<typename T>
+void test_contiguous(std::vector<T> const &v, bool ordered = true)
+{
+    using I = forward_iterator<T const *>;
+    T const *p = v.data();
+    std::ptrdiff_t const expected = base(ranges::min_element(I(p), I(p + v.size()))) - p;
+    CHECK((ranges::min_element(v) - v.begin()) == expected);
+    if(ordered)
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            CHECK((ranges::min_element(ranges::parallel_policy{threads}, v) - v.begin()) ==
+                expected);
+        }
+}
+
+void test_contiguous()
+{
+    for(int n : {1, 255, 256, 257, 1000, 70000, 100003})
+        for(int plant : {-1, 0, n / 2, n - 1})
+        {
+            std::vector<int> v(n);
+            std::vector<float> f(n);
+            for(int i = 0; i < n; ++i)
+            {
+                v[i] = (i * 7919 + 13) % 101;
+                f[i] = static_cast<float>(v[i] - 50);
+                if(0.f == f[i] && (i & 1))
+                    f[i] = -0.f;
+            }
+            if(plant >= 0)
+            {
+                v[plant] = -1;
+                f[plant] = -100.f;
+            }
+            test_contiguous(v);
+            test_contiguous(f);
+            if(n > 300)
+            {
+                // Not an order; the elements are compared one at a time.
+                f[300] = std::numeric_limits<float>::quiet_NaN();
+                test_contiguous(f, false);
+            }
+        }
+}
+
 struct S
 {
     int i;
@@ -142,10 +193,22 @@ int main()
     test_iter_comp<bidirectional_iterator<const int*>, sentinel<const int*>>();
     test_iter_comp<random_access_iterator<const int*>, sentinel<const int*>>();
 
+    test_contiguous();
+
     // Works with projections?
     S s[] = {S{1},S{2},S{3},S{4},S{-4},S{5},S{6},S{7},S{8},S{9}};
     S const *ps = ranges::min_element(s, std::less<int>{}, &S::i);
     CHECK(ps->i == -4);
 
+    // Over view::zip
+    {
+        std::vector<int> k(100000, 0), v(100000, 0);
+        k[50000] = -1;
+        k[60000] = 1;
+        auto z = ranges::view::zip(k, v);
+        CHECK((ranges::min_element(ranges::parallel_policy{3}, z, ranges::less(), first_of())
+            - ranges::begin(z)) == 50000);
+    }
+
     return test_result();
 }
@@ -20,8 +20,11 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -121,5 +124,47 @@ int main()
     CHECK(ps2.first->i == -4);
     CHECK(ps2.second->i == 5);
 
+    // The parallel overloads return the first mismatch, whatever the number of
+    // threads.
+    {
+        int const n = 100000;
+        std::vector<int> a(n), b(n + 10);
+        for(int i = 0; i < n + 10; ++i)
+            b[i] = i < n ? (a[i] = i) : -1;
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            auto r = ranges::mismatch(policy, a, b);
+            CHECK((r.first - a.begin()) == n);
+            CHECK((r.second - b.begin()) == n);
+            r = ranges::mismatch(policy, b.begin(), b.begin() + 50000, a.begin());
+            CHECK((r.first - b.begin()) == 50000);
+            b[70000] = b[30000] = -2;
+            r = ranges::mismatch(policy, a, b);
+            CHECK((r.first - a.begin()) == 30000);
+            CHECK((r.second - b.begin()) == 30000);
+            r = ranges::mismatch(policy, a.begin(), a.end(), b.begin());
+            CHECK((r.first - a.begin()) == 30000);
+            b[70000] = 70000;
+            b[30000] = 30000;
+        }
+        std::pair<S const *, S const *> pp
+            = ranges::mismatch(ranges::par, s1, s2, std::equal_to<int>(), &S::i, &S::i);
+        CHECK(pp.first->i == -4);
+    }
+
+    // Over view::zip
+    {
+        std::vector<int> k1(100000), k2(100000), v(100000, 0);
+        for(int i = 0; i < 100000; ++i)
+            k1[i] = k2[i] = i;
+        k2[70000] = k2[30000] = -1;
+        auto z1 = ranges::view::zip(k1, v);
+        auto z2 = ranges::view::zip(k2, v);
+        auto r = ranges::mismatch(ranges::parallel_policy{3}, z1, z2, firsts_equal());
+        CHECK((r.first - z1.begin()) == 30000);
+        CHECK((r.second - z2.begin()) == 30000);
+    }
+
     return test_result();
 }
@@ -20,6 +20,9 @@
 
 #include <cassert>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/nth_element.hpp>
@@ -59,6 +62,106 @@ test(unsigned N)
     test_one(N, N-1);
 }
 
+void
+test_pattern(std::vector<int> v, unsigned M)
+{
+    std::vector<int> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    auto nth = v.begin() + M;
+    CHECK(ranges::nth_element(v, nth) == v.end());
+    CHECK(*nth == sorted[M]);
+    CHECK(std::all_of(v.begin(), nth, [&](int i){return i <= *nth;}));
+    CHECK(std::all_of(nth, v.end(), [&](int i){return i >= *nth;}));
+}
+
+void
+test_large(unsigned N)
+{
+    std::vector<int> v(N);
+    for(unsigned i = 0; i < N; ++i)
+        v[i] = (int)i;
+    unsigned const Ms[] = {0, 1, N/100, N/2, N - N/100, N-2, N-1};
+    for(unsigned M : Ms)
+    {
+        std::random_shuffle(v.begin(), v.end());
+        test_pattern(v, M);
+        // sorted and reverse sorted
+        std::sort(v.begin(), v.end());
+        test_pattern(v, M);
+        std::reverse(v.begin(), v.end());
+        test_pattern(v, M);
+        // organ pipe
+        for(unsigned i = 0; i < N; ++i)
+            v[i] = (int)(i < N/2 ? i : N - i);
+        test_pattern(v, M);
+        // all equal
+        std::fill(v.begin(), v.end(), 42);
+        test_pattern(v, M);
+        // few distinct values
+        for(unsigned i = 0; i < N; ++i)
+            v[i] = (int)(i % 3);
+        test_pattern(v, M);
+    }
+}
+
+void
+test_multiple(unsigned N)
+{
+    std::vector<int> v(N);
+    for(unsigned i = 0; i < N; ++i)
+        v[i] = (int)i;
+    std::random_shuffle(v.begin(), v.end());
+    std::vector<unsigned> ks = {N/2, N - N/100, N - N/1000, 0, N/2, N};
+    CHECK(ranges::nth_elements(v, ks) == v.end());
+    CHECK((unsigned)v[0] == 0u);
+    CHECK((unsigned)v[N/2] == N/2);
+    CHECK((unsigned)v[N - N/100] == N - N/100);
+    CHECK((unsigned)v[N - N/1000] == N - N/1000);
+    for(unsigned i = 0; i < N; ++i)
+    {
+        if(i < N/2)
+            CHECK((unsigned)v[i] < N/2);
+        else if(i > N - N/1000)
+            CHECK((unsigned)v[i] > N - N/1000);
+    }
+
+    std::random_shuffle(v.begin(), v.end());
+    ranges::nth_elements(v, {N/4, N/2, 3*N/4}, std::greater<int>());
+    CHECK((unsigned)v[N/4] == N - 1 - N/4);
+    CHECK((unsigned)v[N/2] == N - 1 - N/2);
+    CHECK((unsigned)v[3*N/4] == N - 1 - 3*N/4);
+}
+
+// The median-of-medians fallback, which takes over from a
+// floyd_rivest_select pass that makes too little progress.
+void
+test_linear_select(unsigned N)
+{
+    std::vector<int> v(N);
+    ranges::ordered_less pred;
+    ranges::ident proj;
+    unsigned const Ms[] = {0, 1, N/3, N/2, N-2, N-1};
+    for(unsigned M : Ms)
+    {
+        for(int pattern = 0; pattern < 4; ++pattern)
+        {
+            for(unsigned i = 0; i < N; ++i)
+                v[i] = pattern == 0 ? (int)i :
+                       pattern == 1 ? (int)(N - i) :
+                       pattern == 2 ? (int)(i % 3) : (int)(i < N/2 ? i : N - i);
+            if(pattern == 0)
+                std::random_shuffle(v.begin(), v.end());
+            std::vector<int> sorted = v;
+            std::sort(sorted.begin(), sorted.end());
+            auto nth = v.begin() + M;
+            ranges::detail::linear_select(v.begin(), nth, v.end(), pred, proj);
+            CHECK(*nth == sorted[M]);
+            CHECK(std::all_of(v.begin(), nth, [&](int i){return i <= *nth;}));
+            CHECK(std::all_of(nth, v.end(), [&](int i){return i >= *nth;}));
+        }
+    }
+}
+
 struct S
 {
     int i,j;
@@ -76,6 +179,23 @@ int main()
     test(997);
     test(1000);
     test(1009);
+    test_large(10000);
+    test_large(100001);
+    test_multiple(1000);
+    test_multiple(100000);
+    test_linear_select(601);
+    test_linear_select(10007);
+
+    // Offsets past the end are ignored, even past the largest difference.
+    {
+        std::vector<int> v(1000);
+        for(int i = 0; i < 1000; ++i)
+            v[i] = i;
+        std::random_shuffle(v.begin(), v.end());
+        std::vector<std::size_t> ks = {500, std::size_t(PTRDIFF_MAX) + 1, std::size_t(-1), 1000};
+        CHECK(ranges::nth_elements(v, ks) == v.end());
+        CHECK(v[500] == 500);
+    }
 
     // Works with projections?
     const int N = 257;
@@ -87,6 +207,10 @@ int main()
     ranges::nth_element(ia, ia+M, std::less<int>(), &S::i);
     CHECK(ia[M].i == M);
     CHECK(ia[M].j == M);
+    std::random_shuffle(ia, ia+N);
+    ranges::nth_elements(ia, {M, N-1}, std::less<int>(), &S::i);
+    CHECK(ia[M].i == M);
+    CHECK(ia[N-1].j == N-1);
 
     return test_result();
 }
@@ -23,9 +23,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -204,5 +207,27 @@ int main()
     for (S* i = r; i < ia+sa; ++i)
         CHECK(!is_odd()(i->i));
 
+    // Parallel partition, with the partition point in various chunks
+    for(int percent : {0, 1, 50, 99, 100})
+    {
+        std::vector<int> v(100003);
+        for(int i = 0; i < (int)v.size(); ++i)
+            v[i] = (i * 7919) % 100;
+        std::vector<int> sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        auto pred = [=](int i) { return i < percent; };
+        std::ptrdiff_t const trues = std::count_if(v.begin(), v.end(), pred);
+        for(std::size_t threads : {1, 3, 8})
+        {
+            std::vector<int> w = v;
+            auto it = ranges::partition(ranges::parallel_policy{threads}, w, pred);
+            CHECK((it - w.begin()) == trues);
+            CHECK(std::all_of(w.begin(), it, pred));
+            CHECK(std::none_of(it, w.end(), pred));
+            std::sort(w.begin(), w.end());
+            CHECK(w == sorted);
+        }
+    }
+
     return ::test_result();
 }
@@ -23,9 +23,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <tuple>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition_copy.hpp>
 #include <range/v3/view/counted.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -109,6 +111,59 @@ void test_proj()
     CHECK(r2[3].i == 8);
 }
 
+// The branch-free path for contiguous arithmetic elements, and the parallel
+// overloads, across block and chunk boundaries
+template<typename T>
+void test_compact()
+{
+    for(int n : {0, 1, 63, 64, 65, 1000, 100003})
+    {
+        std::vector<T> v(n);
+        for(int i = 0; i < n; ++i)
+            v[i] = static_cast<T>((i * 7919) % 101);
+        auto pred = [](T t) { return t < T(30); };
+        std::vector<T> yes, no;
+        for(T t : v)
+            (pred(t) ? yes : no).push_back(t);
+
+        std::vector<T> r1(n), r2(n);
+        auto p = ranges::partition_copy(v, r1.begin(), r2.begin(), pred);
+        CHECK(std::get<0>(p) == v.end());
+        CHECK((std::get<1>(p) - r1.begin()) == (std::ptrdiff_t)yes.size());
+        CHECK((std::get<2>(p) - r2.begin()) == (std::ptrdiff_t)no.size());
+        CHECK(std::equal(yes.begin(), yes.end(), r1.begin()));
+        CHECK(std::equal(no.begin(), no.end(), r2.begin()));
+
+        for(std::size_t threads : {1, 3, 8})
+        {
+            std::vector<T> s1(n), s2(n);
+            auto q = ranges::partition_copy(ranges::parallel_policy{threads}, v, s1.begin(),
+                random_access_iterator<T *>(s2.data()), pred);
+            CHECK(std::get<0>(q) == v.end());
+            CHECK((std::get<1>(q) - s1.begin()) == (std::ptrdiff_t)yes.size());
+            CHECK((std::get<2>(q).base() - s2.data()) == (std::ptrdiff_t)no.size());
+            CHECK(s1 == r1);
+            CHECK(s2 == r2);
+        }
+    }
+}
+
+void test_parallel_proj()
+{
+    std::vector<S> v(50000);
+    for(int i = 0; i < 50000; ++i)
+        v[i].i = i;
+    std::vector<S> r1(50000), r2(50000);
+    auto p = ranges::partition_copy(ranges::parallel_policy{4}, v, r1.begin(), r2.begin(),
+        is_odd(), &S::i);
+    CHECK((std::get<1>(p) - r1.begin()) == 25000);
+    CHECK((std::get<2>(p) - r2.begin()) == 25000);
+    bool ok = true;
+    for(int i = 0; i < 25000; ++i)
+        ok = ok && r1[i].i == 2 * i + 1 && r2[i].i == 2 * i;
+    CHECK(ok);
+}
+
 int main()
 {
     test_iter<input_iterator<const int*> >();
@@ -119,5 +174,11 @@ int main()
 
     test_proj();
 
+    test_compact<int>();
+    test_compact<double>();
+    test_compact<unsigned char>();
+    test_compact<long long>();
+    test_parallel_proj();
+
     return ::test_result();
 }
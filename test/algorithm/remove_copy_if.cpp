@@ -23,10 +23,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/remove_copy_if.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -152,5 +154,25 @@ int main()
         CHECK(ib[5].i == 4);
     }
 
+    // The parallel overloads keep the order of the copied elements
+    {
+        std::vector<int> v(100000);
+        for(int i = 0; i < 100000; ++i)
+            v[i] = i;
+        for(std::size_t threads : {1, 3, 8})
+        {
+            std::vector<int> out(100000, -1);
+            auto r = ranges::remove_copy_if(ranges::parallel_policy{threads}, v, out.begin(),
+                [](int i){return i % 3 == 0;});
+            CHECK(r.first == v.end());
+            CHECK((r.second - out.begin()) == 66666);
+            bool ok = true;
+            for(int i = 0; i < 66666; ++i)
+                ok = ok && out[i] == i + i / 2 + 1;
+            CHECK(ok);
+            CHECK(out[66666] == -1);
+        }
+    }
+
     return ::test_result();
 }
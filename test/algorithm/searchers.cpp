@@ -0,0 +1,169 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/search.hpp>
+#include <range/v3/algorithm/searchers.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+// Equality comparable, but not ordered
+struct Unordered
+{
+    int i;
+    friend bool operator==(Unordered a, Unordered b) { return a.i == b.i; }
+    friend bool operator!=(Unordered a, Unordered b) { return a.i != b.i; }
+};
+
+template<typename Searcher, typename Rng, typename Pat>
+void check_searcher(Rng &text, Pat const &pat)
+{
+    auto s = Searcher{pat};
+    auto expected = std::search(text.begin(), text.end(), pat.begin(), pat.end());
+    auto res = s(text.begin(), text.end());
+    CHECK(res.first == expected);
+    if(expected != text.end() || pat.empty())
+        CHECK((res.second - res.first) == (std::ptrdiff_t)pat.size());
+    else
+        CHECK(res.second == text.end());
+    CHECK(ranges::search(text, s) == expected);
+}
+
+template<typename Rng, typename Pat>
+void check_all(Rng &text, Pat const &pat)
+{
+    using V = ranges::range_value_t<Pat>;
+    check_searcher<ranges::default_searcher<V>>(text, pat);
+    check_searcher<ranges::boyer_moore_horspool_searcher<V>>(text, pat);
+    check_searcher<ranges::two_way_searcher<V>>(text, pat);
+    CHECK(ranges::search(text, pat) ==
+        std::search(text.begin(), text.end(), pat.begin(), pat.end()));
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Simple cases
+    {
+        std::string text("Now is the time for all good men to come to the aid of their country.");
+        for(std::string pat : {"", "N", "Now", "the", "their", ".", "country.", "z",
+            "countryy", "to the aid", "Now is the time for all good men to come to the aid "
+            "of their country. And more."})
+            check_all(text, pat);
+    }
+
+    // Periodic patterns and texts, which exercise the Two-Way memory, and
+    // every non-empty pattern over a small alphabet
+    {
+        std::string text("abaabaabbabaabaabaababaababaabab");
+        for(std::string pat : {"aba", "abaab", "abaabaab", "abab", "babab", "aaa", "bb",
+            "abaababaab", "aabaabaa"})
+            check_all(text, pat);
+        for(int len = 1; len <= 6; ++len)
+            for(int bits = 0; bits < (1 << len); ++bits)
+            {
+                std::string pat;
+                for(int i = 0; i < len; ++i)
+                    pat.push_back((bits >> i) & 1 ? 'b' : 'a');
+                check_all(text, pat);
+            }
+    }
+
+    // Random byte data with long patterns, on both sides of the SSE2 block size
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist('a', 'd');
+        std::vector<char> text(5000);
+        for(auto &c : text)
+            c = static_cast<char>(dist(gen));
+        for(std::size_t m : {2u, 3u, 15u, 16u, 17u, 100u, 1000u})
+        {
+            for(std::size_t at : {0u, 1u, 31u, 2500u})
+            {
+                if(at + m > text.size())
+                    continue;
+                std::vector<char> pat(text.begin() + at, text.begin() + at + m);
+                check_all(text, pat);
+                pat.back() = 'z';
+                check_all(text, pat);
+            }
+        }
+    }
+
+    // Non-byte elements
+    {
+        std::vector<int> text{1, 2, 3, 1, 2, 3, 4, 1, 2, 3, 4, 5};
+        check_all(text, std::vector<int>{1, 2, 3, 4, 5});
+        check_all(text, std::vector<int>{3, 4});
+        check_all(text, std::vector<int>{4, 4});
+        check_all(text, std::vector<int>{});
+    }
+
+    // The default searcher needs only forward iterators
+    {
+        std::list<int> text{1, 2, 3, 4, 5};
+        auto s = make_default_searcher({3, 4});
+        auto res = s(text.begin(), text.end());
+        CHECK(res.first == std::next(text.begin(), 2));
+        CHECK(res.second == std::next(text.begin(), 4));
+        auto res2 = make_default_searcher({5, 6})(text.begin(), text.end());
+        CHECK(res2.first == text.end());
+        CHECK(res2.second == text.end());
+    }
+
+    // Searchers can be made from any input range
+    {
+        char const text[] = "the quick brown fox";
+        CHECK(search(text, make_boyer_moore_horspool_searcher(std::string("brown"))) == text + 10);
+        CHECK(search(text, make_two_way_searcher(std::string("fox"))) == text + 16);
+        CHECK(search(begin(text), end(text), make_two_way_searcher(std::string("cat"))) == end(text));
+    }
+
+    // Elements of a transformed range are read through the iterator's
+    // reference, not operator[]'s proxy.
+    {
+        std::vector<int> v{1, 2, 3, 4, 5, 3, 4};
+        auto t = v | view::transform([](int i) { return i * 10; });
+        std::vector<int> pat{30, 40, 50};
+        auto r1 = make_boyer_moore_horspool_searcher(pat)(begin(t), end(t));
+        CHECK((r1.first - begin(t)) == 2);
+        CHECK((r1.second - begin(t)) == 5);
+        auto r2 = make_two_way_searcher(pat)(begin(t), end(t));
+        CHECK((r2.first - begin(t)) == 2);
+        CHECK((r2.second - begin(t)) == 5);
+        CHECK((search(t, make_two_way_searcher(std::vector<int>{30, 40})) - begin(t)) == 2);
+
+        std::string str("a needle in a haystack");
+        auto u = str | view::transform([](char c) {
+            return 'a' <= c && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+        });
+        std::string upat("NEEDLE");
+        CHECK((make_boyer_moore_horspool_searcher(upat)(begin(u), end(u)).first - begin(u)) == 2);
+        CHECK((make_two_way_searcher(upat)(begin(u), end(u)).first - begin(u)) == 2);
+    }
+
+    // Two-Way needs an order on the elements; the other searchers do not.
+    {
+        using P = std::vector<Unordered> const &;
+        CONCEPT_ASSERT(std::is_constructible<default_searcher<Unordered>, P>::value);
+        CONCEPT_ASSERT(!std::is_constructible<two_way_searcher<Unordered>, P>::value);
+        CONCEPT_ASSERT(std::is_constructible<two_way_searcher<int>, std::vector<int> const &>::value);
+    }
+
+    return test_result();
+}
@@ -23,10 +23,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/numeric/iota.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -64,5 +67,82 @@ int main()
         CHECK(!ranges::equal(ia, ib));
     }
 
+    // The whole range is shuffled, and the end is returned
+    {
+        int ia[100];
+        int orig[100];
+        ranges::iota(ia, 0);
+        ranges::iota(orig, 0);
+        std::mt19937_64 g;
+        CHECK(ranges::shuffle(ia, g) == ranges::end(ia));
+        CHECK(!ranges::equal(ia, orig));
+        ranges::sort(ia);
+        CHECK(ranges::equal(ia, orig));
+    }
+
+    // Every permutation of a small range turns up, about equally often
+    {
+        std::mt19937 g;
+        int counts[6] = {};
+        for(int i = 0; i < 6000; ++i)
+        {
+            int ia[] = {0, 1, 2};
+            ranges::shuffle(ia, g);
+            int const p = ia[0] * 2 + (ia[1] > ia[2]);
+            ++counts[p];
+        }
+        for(int c : counts)
+            CHECK((c > 850 && c < 1150));
+    }
+
+    // The parallel shuffle gives the same permutation whatever the number of
+    // threads, and for large ranges, a different one for a different seed
+    {
+        std::vector<int> v(150000), orig(v.size());
+        ranges::iota(orig, 0);
+        std::vector<int> results[3];
+        std::size_t const threads[] = {1, 3, 8};
+        for(int i = 0; i < 3; ++i)
+        {
+            ranges::iota(v, 0);
+            std::mt19937_64 g{42};
+            CHECK(ranges::shuffle(ranges::parallel_policy{threads[i]}, v, g) == v.end());
+            results[i] = v;
+        }
+        CHECK(results[0] == results[1]);
+        CHECK(results[0] == results[2]);
+        CHECK(results[0] != orig);
+        // Neither half stays put
+        CHECK(!ranges::equal(v.begin(), v.begin() + v.size() / 2, orig.begin()));
+        CHECK(!ranges::equal(v.begin() + v.size() / 2, v.end(), orig.begin() + v.size() / 2));
+        ranges::sort(v);
+        CHECK(v == orig);
+
+        ranges::iota(v, 0);
+        std::mt19937_64 g{43};
+        ranges::shuffle(ranges::par, v.begin(), v.end(), g);
+        CHECK(v != results[0]);
+
+        // Elements from the first block end up anywhere
+        std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(v.size());
+        std::ptrdiff_t moved_far = 0;
+        for(std::ptrdiff_t i = 0; i < n; ++i)
+            moved_far += v[i] < n / 4 && i >= n / 2;
+        CHECK(moved_far > n / 10);
+    }
+
+    // Small ranges are shuffled by the parallel overload too
+    {
+        int ia[100];
+        int orig[100];
+        ranges::iota(ia, 0);
+        ranges::iota(orig, 0);
+        std::minstd_rand g;
+        ranges::shuffle(ranges::par, ia, g);
+        CHECK(!ranges::equal(ia, orig));
+        ranges::sort(ia);
+        CHECK(ranges::equal(ia, orig));
+    }
+
     return ::test_result();
 }
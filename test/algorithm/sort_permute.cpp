@@ -0,0 +1,100 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sort_permute.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct S
+{
+    int i;
+    int j;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    // Every column follows the keys.
+    {
+        std::vector<int> keys;
+        std::vector<std::string> names;
+        std::vector<double> halves;
+        for(int i = 0; i < 1000; ++i)
+        {
+            keys.push_back((i * 37) % 1009);
+            names.push_back(std::to_string(i));
+            halves.push_back(i * 0.5);
+        }
+        auto it = sort_permute(keys, names, halves);
+        CHECK(it == keys.end());
+        CHECK(is_sorted(keys));
+        for(std::size_t r = 0; r < keys.size(); ++r)
+        {
+            int const i = static_cast<int>(halves[r] * 2);
+            CHECK(keys[r] == (i * 37) % 1009);
+            CHECK(names[r] == std::to_string(i));
+        }
+    }
+
+    // With no other columns it just sorts the keys.
+    {
+        std::vector<int> keys{3, 1, 2};
+        sort_permute(keys);
+        ::check_equal(keys, {1, 2, 3});
+    }
+
+    // A comparison and a projection, and payloads that are views or longer
+    // than the keys.
+    {
+        S keys[] = {{0, 4}, {1, 1}, {2, 3}, {3, 0}, {4, 2}};
+        std::vector<char> a{'a', 'b', 'c', 'd', 'e', 'z'};
+        std::vector<int> b{0, 1, 2, 3, 4};
+        std::vector<int> c{4, 3, 2, 1, 0};
+        sort_permute(keys, std::greater<int>(), &S::j, a, view::zip(b, c));
+        for(int r = 0; r < 5; ++r)
+            CHECK(keys[r].j == 4 - r);
+        ::check_equal(a, {'a', 'c', 'e', 'b', 'd', 'z'});
+        ::check_equal(b, {0, 2, 4, 1, 3});
+        ::check_equal(c, {4, 2, 0, 3, 1});
+    }
+
+    // Move-only keys and payloads; the keys can be a view.
+    {
+        std::vector<std::unique_ptr<int>> keys;
+        std::vector<std::unique_ptr<int>> values;
+        for(int i = 0; i < 20; ++i)
+        {
+            keys.emplace_back(new int(i));
+            values.emplace_back(new int(100 + i));
+        }
+        sort_permute(keys | view::reverse,
+            [](std::unique_ptr<int> const &x, std::unique_ptr<int> const &y)
+            {
+                return *x < *y;
+            }, ident{}, values);
+        for(int i = 0; i < 20; ++i)
+        {
+            CHECK(*keys[i] == 19 - i);
+            CHECK(*values[i] == 119 - i);
+        }
+    }
+
+    return ::test_result();
+}
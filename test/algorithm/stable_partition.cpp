@@ -23,9 +23,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -414,5 +417,50 @@ int main()
         CHECK(ap[9].p == P{4, 2});
     }
 
+    // Parallel stable partition of arithmetic elements, which are moved as
+    // bytes, and of other elements
+    for(int percent : {0, 1, 50, 100})
+    {
+        std::vector<int> v(100003);
+        for(int i = 0; i < (int)v.size(); ++i)
+            v[i] = (i * 7919) % 100;
+        auto pred = [=](int i) { return i < percent; };
+        std::vector<int> expected = v;
+        auto const mid = std::stable_partition(expected.begin(), expected.end(), pred);
+        std::vector<std::pair<int, int>> pairs(v.size());
+        for(int i = 0; i < (int)v.size(); ++i)
+            pairs[i] = {v[i], i};
+        for(std::size_t threads : {1, 3, 8})
+        {
+            std::vector<int> w = v;
+            auto it = ranges::stable_partition(ranges::parallel_policy{threads}, w, pred);
+            CHECK((it - w.begin()) == (mid - expected.begin()));
+            CHECK(w == expected);
+
+            std::vector<std::pair<int, int>> q = pairs;
+            auto jt = ranges::stable_partition(ranges::parallel_policy{threads}, q.begin(),
+                q.end(), pred, &std::pair<int, int>::first);
+            CHECK((jt - q.begin()) == (mid - expected.begin()));
+            bool ok = true;
+            for(std::size_t i = 0; i < q.size(); ++i)
+                ok = ok && q[i].first == expected[i] && (i == 0 ||
+                    (q[i - 1].first < percent) != (q[i].first < percent) ||
+                    q[i - 1].second < q[i].second);
+            CHECK(ok);
+        }
+    }
+    {
+        std::vector<std::unique_ptr<int>> v;
+        for(int i = 0; i < 50000; ++i)
+            v.emplace_back(new int(i));
+        auto it = ranges::stable_partition(ranges::parallel_policy{4}, v,
+            [](std::unique_ptr<int> const &p) { return *p % 2 == 1; });
+        CHECK((it - v.begin()) == 25000);
+        bool ok = true;
+        for(int i = 0; i < 25000; ++i)
+            ok = ok && v[i] && *v[i] == 2 * i + 1 && v[i + 25000] && *v[i + 25000] == 2 * i;
+        CHECK(ok);
+    }
+
     return ::test_result();
 }
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/view/zip.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -212,5 +213,23 @@ int main()
         }
     }
 
+    // Check zipped ranges, whose elements are proxies; the merges search them
+    // with lower_bound and upper_bound
+    {
+        std::vector<int> k(1000), v(1000);
+        for(int i = 0; (std::size_t)i < k.size(); ++i)
+        {
+            k[i] = (k.size() - i - 1) / 2;
+            v[i] = i;
+        }
+        auto z = ranges::view::zip(k, v);
+        ranges::stable_sort(z);
+        for(int i = 0; (std::size_t)i < k.size(); ++i)
+        {
+            CHECK(k[i] == i / 2);
+            CHECK((std::size_t)v[i] == k.size() - 2 * (i / 2) - 2 + i % 2);
+        }
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <limits>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/algorithm/top_k.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i, j;
+};
+
+void test(int N, int K)
+{
+    std::vector<int> v(N);
+    for(int i = 0; i < N; ++i)
+        v[i] = i;
+    std::random_shuffle(v.begin(), v.end());
+
+    std::vector<int> expected;
+    for(int i = 0; i < std::min(N, K); ++i)
+        expected.push_back(i);
+    auto r = ranges::top_k(v, K);
+    CHECK(r == expected);
+
+    // Single-pass input
+    auto r2 = ranges::top_k(input_iterator<int const *>(v.data()),
+        sentinel<int const *>(v.data() + N), K);
+    CHECK(r2 == expected);
+
+    // Largest first
+    expected.clear();
+    for(int i = 0; i < std::min(N, K); ++i)
+        expected.push_back(N - 1 - i);
+    auto r3 = ranges::top_k(v, K, std::greater<int>());
+    CHECK(r3 == expected);
+}
+
+int main()
+{
+    test(0, 10);
+    test(5, 0);
+    test(5, 10);
+    test(10, 10);
+    test(1000, 1);
+    test(1000, 7);
+    test(100000, 100);
+
+    // Duplicates
+    std::vector<int> d(1000, 3);
+    d[500] = 1;
+    ::check_equal(ranges::top_k(d, 4), {1, 3, 3, 3});
+
+    // istream_range
+    std::stringstream sin{"5 9 2 7 1 8 3 6 4 0"};
+    ::check_equal(ranges::top_k(ranges::istream<int>(sin), 3, std::greater<int>()), {9, 8, 7});
+
+    // initializer_list
+    ::check_equal(ranges::top_k({4, 2, 3, 1}, 2), {1, 2});
+
+    // Projections
+    S s[] = {{4, 0}, {2, 1}, {3, 2}, {1, 3}, {5, 4}};
+    auto rs = ranges::top_k(s, 2, std::greater<int>(), &S::i);
+    CHECK(rs.size() == 2u);
+    CHECK(rs[0].i == 5);
+    CHECK(rs[0].j == 4);
+    CHECK(rs[1].i == 4);
+    CHECK(rs[1].j == 0);
+
+    // k much larger than the input costs no more than the input
+    std::vector<int> small{3, 1, 2};
+    ::check_equal(ranges::top_k(small, 100000000000), {1, 2, 3});
+    ::check_equal(ranges::top_k(small, std::numeric_limits<std::ptrdiff_t>::max()), {1, 2, 3});
+
+    return ::test_result();
+}
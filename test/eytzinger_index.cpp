@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/eytzinger_index.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct S
+{
+    int key;
+    std::string value;
+};
+
+void test(int N)
+{
+    // Even numbers, each one twice
+    std::vector<int> v;
+    for(int i = 0; i < N; ++i)
+    {
+        v.push_back(2 * i);
+        v.push_back(2 * i);
+    }
+    auto idx = ranges::make_eytzinger_index(v);
+    CHECK(idx.size() == v.size());
+    CHECK(idx.empty() == v.empty());
+
+    auto sorted = idx.sorted();
+    CONCEPT_ASSERT(ranges::BidirectionalRange<decltype(sorted)>());
+    CONCEPT_ASSERT(ranges::BoundedRange<decltype(sorted)>());
+    CONCEPT_ASSERT(ranges::SizedRange<decltype(sorted)>());
+    CHECK(sorted.size() == v.size());
+    ::check_equal(sorted, v);
+    ::check_equal(sorted | ranges::view::reverse, v | ranges::view::reverse);
+
+    for(int i = -1; i <= 2 * N; ++i)
+    {
+        auto lb = std::lower_bound(v.begin(), v.end(), i) - v.begin();
+        auto ub = std::upper_bound(v.begin(), v.end(), i) - v.begin();
+        CHECK(ranges::distance(sorted.begin(), idx.lower_bound(i)) == lb);
+        CHECK(ranges::distance(sorted.begin(), idx.upper_bound(i)) == ub);
+        auto er = idx.equal_range(i);
+        CHECK(ranges::distance(er) == ub - lb);
+        CHECK(idx.contains(i) == (lb != ub));
+    }
+}
+
+int main()
+{
+    test(0);
+    test(1);
+    test(2);
+    test(3);
+    test(7);
+    test(8);
+    test(100);
+    test(1000);
+
+    auto idx = ranges::make_eytzinger_index({9, 7, 5, 3, 1}, std::greater<int>());
+    ::check_equal(idx.sorted(), {9, 7, 5, 3, 1});
+    CHECK(*idx.lower_bound(6) == 5);
+    CHECK(idx.upper_bound(0) == idx.sorted().end());
+    CHECK(!idx.contains(4));
+    CHECK(idx.contains(3));
+
+    std::vector<S> vs{{1, "one"}, {2, "two"}, {3, "three"}, {5, "five"}};
+    auto sidx = ranges::make_eytzinger_index(vs, std::less<int>(), &S::key);
+    CHECK(sidx.lower_bound(3)->value == "three");
+    CHECK(sidx.lower_bound(4)->value == "five");
+    CHECK(sidx.contains(2));
+    CHECK(!sidx.contains(4));
+
+    return test_result();
+}
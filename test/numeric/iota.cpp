@@ -22,9 +22,11 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -47,6 +49,32 @@ void test()
     }
 }
 
+void test_parallel()
+{
+    // Each chunk starts from the value advanced to its first element.
+    for(int n : {0, 1, 1000, 70000, 100003})
+    {
+        for(std::size_t threads : {1u, 3u, 8u})
+        {
+            ranges::parallel_policy const policy{threads};
+            std::vector<long> v(n, 0);
+            CHECK(ranges::iota(policy, v, 5L) == v.end());
+            for(int i = 0; i < n; ++i)
+                if(v[i] != i + 5)
+                {
+                    CHECK(v[i] == i + 5);
+                    break;
+                }
+            CHECK(ranges::iota(policy, v.begin(), v.end(), -3L) == v.end());
+            CHECK((0 == n || v.back() == n - 4));
+        }
+    }
+    int ia[] = {1, 2, 3, 4, 5};
+    int ir[] = {5, 6, 7, 8, 9};
+    ranges::iota(ranges::par, random_access_iterator<int*>(ia), sentinel<int*>(ia + 5), 5);
+    CHECK(ranges::equal(ia, ir));
+}
+
 int main()
 {
     test<input_iterator<int*> >();
@@ -60,5 +88,7 @@ int main()
     test<bidirectional_iterator<int*>, sentinel<int*> >();
     test<random_access_iterator<int*>, sentinel<int*> >();
 
+    test_parallel();
+
     return ::test_result();
 }
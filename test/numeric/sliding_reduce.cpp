@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/numeric/sliding_reduce.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct max_fn
+{
+    int operator()(int a, int b) const
+    {
+        return (std::max)(a, b);
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    int ia[] = {3, 1, 4, 1, 5, 9, 2, 6};
+
+    // With an inverse, each window is found from the one before.
+    {
+        int ir[6] = {};
+        auto r = sliding_reduce(ia, 3, ranges::begin(ir), plus{}, minus{});
+        CHECK(r.first == ranges::end(ia));
+        CHECK(r.second == ranges::end(ir));
+        ::check_equal(ir, {8, 6, 10, 15, 16, 17});
+
+        int ir2[1] = {};
+        auto r2 = sliding_reduce(forward_iterator<int const *>(ia),
+            forward_iterator<int const *>(ia + 8), 8, ranges::begin(ir2), plus{}, minus{});
+        CHECK(r2.first.base() == ia + 8);
+        CHECK(r2.second == ir2 + 1);
+        CHECK(ir2[0] == 31);
+
+        std::vector<int> out;
+        sliding_reduce(ia, 9, ranges::back_inserter(out), plus{}, minus{});
+        CHECK(out.empty());
+        sliding_reduce(ia, 1, ranges::back_inserter(out), plus{}, minus{});
+        ::check_equal(out, ia);
+        std::vector<int> none;
+        CHECK(sliding_reduce(none, 2, ranges::begin(ir), plus{}, minus{}).second == ir);
+    }
+
+    // Without one, the window is kept as a queue of two stacks.
+    {
+        std::vector<int> out;
+        auto r = sliding_reduce(ia, 3, ranges::back_inserter(out), max_fn{});
+        CHECK(r.first == ranges::end(ia));
+        ::check_equal(out, {4, 4, 5, 9, 9, 9});
+
+        for(int n = 1; n <= 9; ++n)
+        {
+            std::vector<int> expected;
+            for(int i = 0; i + n <= 8; ++i)
+                expected.push_back(*std::max_element(ia + i, ia + i + n));
+            std::vector<int> out2;
+            sliding_reduce(input_iterator<int const *>(ia), sentinel<int const *>(ia + 8),
+                n, ranges::back_inserter(out2), max_fn{});
+            CHECK(out2 == expected);
+        }
+
+        // The operation need not be commutative.
+        std::vector<std::string> words{"a", "b", "c", "d", "e"};
+        std::vector<std::string> joined;
+        sliding_reduce(words, 3, ranges::back_inserter(joined), plus{});
+        ::check_equal(joined, {"abc", "bcd", "cde"});
+
+        // Elements are read once, so input ranges work.
+        std::stringstream sin{"5 3 8 1 2"};
+        std::vector<int> mins;
+        auto &&in = istream<int>(sin);
+        sliding_reduce(in, 2, ranges::back_inserter(mins),
+            [](int a, int b) { return (std::min)(a, b); });
+        ::check_equal(mins, {3, 3, 1, 1});
+    }
+
+    return test_result();
+}
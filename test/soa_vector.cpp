@@ -0,0 +1,162 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct first_fn
+{
+    template<typename T>
+    auto operator()(T &&t) const -> decltype(std::get<0>(t))
+    {
+        return std::get<0>(t);
+    }
+};
+
+// Throws when copied for the n-th time
+struct ThrowOnCopy
+{
+    static int countdown;
+    ThrowOnCopy() = default;
+    ThrowOnCopy(ThrowOnCopy const &)
+    {
+        if(0 == --countdown)
+            throw std::runtime_error("copy");
+    }
+    ThrowOnCopy &operator=(ThrowOnCopy const &) = default;
+};
+int ThrowOnCopy::countdown = 0;
+
+int main()
+{
+    using namespace ranges;
+
+    // The elements are those of a zip of the columns.
+    {
+        using V = soa_vector<int, std::string, double>;
+        using Z = zip_view<range<int *>, range<std::string *>, range<double *>>;
+        CONCEPT_ASSERT(Same<range_value_t<V>, range_value_t<Z>>());
+        CONCEPT_ASSERT(Same<range_reference_t<V>, range_reference_t<Z>>());
+        CONCEPT_ASSERT(Same<range_rvalue_reference_t<V>, range_rvalue_reference_t<Z>>());
+        CONCEPT_ASSERT(Same<range_reference_t<V const>,
+            common_tuple<int const &, std::string const &, double const &>>());
+        V v;
+        ::models<concepts::RandomAccessIterator>(v.begin());
+        ::models<concepts::SizedIterable>(v);
+        ::models<concepts::BoundedIterable>(v);
+        ::models_not<concepts::Range>(v);
+        CONCEPT_ASSERT(Same<range_value_t<soa_vector<int, char>>, std::pair<int, char>>());
+    }
+
+    // Rows are added to and removed from every column.
+    {
+        soa_vector<int, std::string> v;
+        CHECK(v.empty());
+        v.reserve(10);
+        CHECK(v.capacity() >= 10u);
+        v.emplace_back(3, "three");
+        v.push_back(std::make_pair(1, std::string("one")));
+        v.emplace_back(2, "two");
+        CHECK(v.size() == 3u);
+        ::check_equal(v.column<0>(), {3, 1, 2});
+        ::check_equal(v.column<1>(), {"three", "one", "two"});
+        CHECK(std::get<1>(v[1]) == "one");
+        std::get<0>(v[1]) = 4;
+        CHECK(v.column<0>()[1] == 4);
+        v.pop_back();
+        ::check_equal(v.column<1>(), {"three", "one"});
+        v.resize(4);
+        ::check_equal(v.column<0>(), {3, 4, 0, 0});
+        CHECK(v.column<1>()[3].empty());
+        auto const &cv = v;
+        ::check_equal(cv.column<0>() | view::reverse, {0, 0, 4, 3});
+        CHECK(std::get<0>(*(cv.end() - 3)) == 4);
+        v.clear();
+        CHECK((v.empty() && v.column<1>().empty()));
+    }
+
+    // Rows can be appended in bulk from another soa_vector or a zip.
+    {
+        std::vector<int> keys{5, 3, 4};
+        std::vector<char> values{'e', 'c', 'd'};
+        soa_vector<int, char> v(view::zip(keys, values));
+        soa_vector<int, char> const w(v);
+        v.append(w);
+        ::check_equal(v.column<0>(), {5, 3, 4, 5, 3, 4});
+        ::check_equal(v.column<1>(), {'e', 'c', 'd', 'e', 'c', 'd'});
+    }
+
+    // Sorting and partitioning permute whole rows.
+    {
+        soa_vector<int, std::string, double> v;
+        for(int i = 0; i < 200; ++i)
+            v.emplace_back((i * 37) % 101, std::to_string(i), i * 0.5);
+        sort(v, std::less<int>(), first_fn());
+        CHECK(is_sorted(v.column<0>()));
+        for(auto &&row : v)
+        {
+            int const i = static_cast<int>(std::get<2>(row) * 2);
+            CHECK(std::get<0>(row) == (i * 37) % 101);
+            CHECK(std::get<1>(row) == std::to_string(i));
+        }
+        stable_sort(v, std::greater<int>(), first_fn());
+        CHECK(is_sorted(v.column<0>() | view::reverse));
+        auto const mid = partition(v, [](int k) { return k % 2 == 0; }, first_fn());
+        for(auto it = v.begin(); it != v.end(); ++it)
+            CHECK((std::get<0>(*it) % 2 == 0) == (it < mid));
+    }
+
+    // Move-only columns are moved, not copied.
+    {
+        soa_vector<std::unique_ptr<int>, int> v;
+        for(int i = 0; i < 20; ++i)
+            v.emplace_back(std::unique_ptr<int>(new int(20 - i)), i);
+        sort(v, [](std::unique_ptr<int> const &a, std::unique_ptr<int> const &b)
+        {
+            return *a < *b;
+        }, first_fn());
+        for(int i = 0; i < 20; ++i)
+            CHECK((*v.column<0>()[i] == i + 1 && v.column<1>()[i] == 19 - i));
+    }
+
+    // A column that throws leaves the number of rows as it was.
+    {
+        soa_vector<int, ThrowOnCopy> v;
+        v.emplace_back(1, ThrowOnCopy{});
+        ThrowOnCopy t;
+        ThrowOnCopy::countdown = 1;
+        bool caught = false;
+        try
+        {
+            v.emplace_back(2, t);
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+        CHECK((v.size() == 1u && v.column<0>().size() == 1u && v.column<1>().size() == 1u));
+    }
+
+    return ::test_result();
+}
@@ -158,4 +158,26 @@ test_range_algo_2<Algo, RvalueOK1, RvalueOK2> make_testable_2(Algo algo)
     return test_range_algo_2<Algo, RvalueOK1, RvalueOK2>{algo};
 }
 
+// Predicates and projections on the member first of a pair-like element,
+// for testing algorithms over view::zip. Zipped elements are proxies: an
+// algorithm must hand them on as the zip's reference type, not as the proxy
+// that operator[] returns, which has no member first.
+struct first_is_even
+{
+    template<typename P>
+    bool operator()(P const &p) const { return p.first % 2 == 0; }
+};
+
+struct firsts_equal
+{
+    template<typename P, typename Q>
+    bool operator()(P const &p, Q const &q) const { return p.first == q.first; }
+};
+
+struct first_of
+{
+    template<typename P>
+    int operator()(P const &p) const { return p.first; }
+};
+
 #endif
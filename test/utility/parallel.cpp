@@ -0,0 +1,76 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <atomic>
+#include <vector>
+#include <range/v3/utility/parallel.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using ranges::detail::parse_sysfs_list;
+
+    // sysfs CPU and node lists
+    ::check_equal(parse_sysfs_list("0"), {0});
+    ::check_equal(parse_sysfs_list("0-3,8,10-11"), {0, 1, 2, 3, 8, 10, 11});
+    ::check_equal(parse_sysfs_list("2,4-5 "), {2, 4, 5});
+    CHECK(parse_sysfs_list("").empty());
+    CHECK(parse_sysfs_list("\n").empty());
+
+    // A pinned policy runs every task, and leaves the calling thread's CPUs
+    // as they were.
+    for(std::size_t threads : {1u, 3u, 8u})
+    {
+        ranges::parallel_policy const policy{threads, true};
+        CHECK(policy.pinned());
+        CHECK(!ranges::parallel_policy{threads}.pinned());
+#if RANGES_NUMA_AFFINITY
+        cpu_set_t before, after;
+        CHECK(0 == sched_getaffinity(0, sizeof(before), &before));
+#endif
+        std::vector<std::atomic<int>> runs(20);
+        for(auto &r : runs)
+            r = 0;
+        std::atomic<bool> on_node(true);
+        ranges::detail::parallel_for(policy, runs.size(), [&](std::size_t k)
+        {
+            ++runs[k];
+#if RANGES_NUMA_AFFINITY
+            // Each thread runs on CPUs of its chunk's node.
+            auto const &nodes = ranges::detail::numa_node_cpus();
+            std::size_t const t = threads < runs.size() ? threads : runs.size();
+            std::size_t chunk = 0;
+            while(ranges::detail::static_chunk(runs.size(), t, chunk).second <= k)
+                ++chunk;
+            cpu_set_t mine, node, both;
+            CPU_ZERO(&node);
+            if(!nodes.empty())
+                for(int cpu : nodes[chunk * nodes.size() / t])
+                    CPU_SET(cpu, &node);
+            if(0 != sched_getaffinity(0, sizeof(mine), &mine))
+                on_node = false;
+            CPU_AND(&both, &mine, &node);
+            if(!nodes.empty() && !CPU_EQUAL(&both, &mine))
+                on_node = false;
+#endif
+        });
+        for(auto &r : runs)
+            CHECK(r == 1);
+        CHECK(on_node);
+#if RANGES_NUMA_AFFINITY
+        CHECK(0 == sched_getaffinity(0, sizeof(after), &after));
+        CHECK(CPU_EQUAL(&before, &after));
+#endif
+    }
+
+    return ::test_result();
+}
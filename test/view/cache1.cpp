@@ -0,0 +1,79 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/cache1.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{1, 2, 3, 4, 5, 6, 7};
+    int calls = 0;
+    auto square = [&](int i) { ++calls; return i * i; };
+    auto is_even = [](int i) { return i % 2 == 0; };
+
+    // Without the cache, remove_if reads each element that it keeps twice.
+    ::check_equal(v | view::transform(square) | view::remove_if(is_even), {1, 9, 25, 49});
+    CHECK(calls == 11);
+
+    calls = 0;
+    auto rng = v | view::transform(square) | view::cache1;
+    ::models<concepts::InputRange>(rng);
+    ::models_not<concepts::ForwardRange>(rng);
+    CONCEPT_ASSERT(!InputRange<decltype(rng) const>());
+    ::models<concepts::SizedRange>(rng);
+    CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, int const &>());
+    CONCEPT_ASSERT(Same<range_rvalue_reference_t<decltype(rng)>, int &&>());
+    CHECK(rng.size() == 7u);
+    ::check_equal(rng | view::remove_if(is_even), {1, 9, 25, 49});
+    CHECK(calls == 7);
+
+    // Elements are read only when dereferenced.
+    calls = 0;
+    auto rng2 = v | view::transform(square) | view::cache1;
+    auto it = begin(rng2);
+    ++it;
+    ++it;
+    CHECK(*it == 9);
+    CHECK(*it == 9);
+    CHECK(calls == 1);
+
+    // The cached elements are copies, so they cannot be written through the view.
+    std::vector<int> w{1, 2, 3};
+    auto rng4 = w | view::cache1;
+    CONCEPT_ASSERT(!Writable<range_iterator_t<decltype(rng4)>, int>());
+    CONCEPT_ASSERT(!OutputRange<decltype(rng4), int>());
+
+    // Cached elements can be moved from.
+    std::vector<std::string> words{"a", "bb", "ccc"};
+    std::vector<std::string> out(3);
+    auto doubled = words | view::transform([](std::string const &s) { return s + s; })
+        | view::cache1;
+    move(doubled, out.begin());
+    ::check_equal(out, {"aa", "bbbb", "cccccc"});
+
+    calls = 0;
+    auto rng3 = v | view::transform(square) | view::cache1
+        | view::take_while([](int i) { return i < 20; });
+    ::check_equal(rng3, {1, 4, 9, 16});
+    CHECK(calls == 5);
+
+    return test_result();
+}
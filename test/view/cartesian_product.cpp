@@ -0,0 +1,113 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <tuple>
+#include <vector>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/cartesian_product.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+template<typename Rng>
+std::vector<std::tuple<int, char>> to_pairs(Rng &&rng)
+{
+    std::vector<std::tuple<int, char>> res;
+    for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        res.emplace_back(*it);
+    return res;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> a{1, 2};
+    std::vector<char> b{'x', 'y', 'z'};
+    std::vector<std::tuple<int, char>> const expected{
+        std::make_tuple(1, 'x'), std::make_tuple(1, 'y'), std::make_tuple(1, 'z'),
+        std::make_tuple(2, 'x'), std::make_tuple(2, 'y'), std::make_tuple(2, 'z')};
+
+    // Over sized random-access ranges, the i-th tuple is found from i.
+    {
+        auto rng = view::cartesian_product(a, b);
+        ::models<concepts::RandomAccessRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::BoundedRange>(rng);
+        CONCEPT_ASSERT(RandomAccessRange<decltype(rng) const>());
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, std::tuple<int, char>>());
+        CHECK(rng.size() == 6u);
+        CHECK(to_pairs(rng) == expected);
+        auto it = begin(rng);
+        CHECK(std::get<0>(*(it + 4)) == 2);
+        CHECK(std::get<1>(*(it + 4)) == 'y');
+        CHECK(std::get<1>(*((it + 5) - 4)) == 'y');
+        CHECK((end(rng) - it) == 6);
+        CHECK(std::get<1>(*(end(rng) - 1)) == 'z');
+        auto rev = to_pairs(rng | view::reverse);
+        CHECK(std::vector<std::tuple<int, char>>(rev.rbegin(), rev.rend()) == expected);
+
+        // Elements can be written through.
+        std::get<0>(*begin(rng)) = 3;
+        CHECK(a[0] == 3);
+        a[0] = 1;
+
+        std::vector<int> none;
+        auto empty = view::cartesian_product(a, none, b);
+        CHECK(empty.size() == 0u);
+        CHECK(begin(empty) == end(empty));
+        CHECK(view::cartesian_product(b).size() == 3u);
+    }
+
+    // Over other forward ranges, the last range is stepped innermost.
+    {
+        std::list<int> li(a.begin(), a.end());
+        std::forward_list<char> fl(b.begin(), b.end());
+        auto rng = view::cartesian_product(li, fl);
+        ::models<concepts::ForwardRange>(rng);
+        ::models_not<concepts::BidirectionalRange>(rng);
+        ::models_not<concepts::SizedRange>(rng);
+        CHECK(to_pairs(rng) == expected);
+        CHECK(distance(rng) == 6);
+
+        auto no_y = fl | view::remove_if([](char c) { return c == 'y'; });
+        auto rng2 = view::cartesian_product(no_y, li);
+        CHECK(distance(rng2) == 4);
+        CHECK(view::cartesian_product(li, li).size() == 4u);
+
+        std::list<int> none;
+        CHECK(begin(view::cartesian_product(li, none)) == end(view::cartesian_product(li, none)));
+        CHECK(begin(view::cartesian_product(none, fl)) == end(view::cartesian_product(none, fl)));
+    }
+
+    // A random-access product can be searched in parallel.
+    {
+        std::vector<int> sides;
+        for(int i = 1; i <= 20; ++i)
+            sides.push_back(i);
+        auto triples = view::cartesian_product(sides, sides, sides);
+        CHECK(triples.size() == 8000u);
+        auto pythagorean = [](common_tuple<int &, int &, int &> t)
+        {
+            int x = std::get<0>(t), y = std::get<1>(t), z = std::get<2>(t);
+            return x < y && x * x + y * y == z * z;
+        };
+        CHECK(count_if(triples, pythagorean) == 6);
+        CHECK(count_if(parallel_policy{4}, triples, pythagorean) == 6);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,134 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <limits>
+#include <vector>
+#include <sstream>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    // Chunks of a sized random-access range are found from their index.
+    {
+        auto rng = v | view::chunk(3);
+        ::models<concepts::RandomAccessRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::BoundedRange>(rng);
+        CONCEPT_ASSERT(RandomAccessRange<decltype(rng) const>());
+        CHECK(rng.size() == 4u);
+        CHECK(distance(rng) == 4);
+        auto it = begin(rng);
+        ::check_equal(*it, {0, 1, 2});
+        ::check_equal(*(it + 3), {9, 10});
+        CHECK(size(*(it + 3)) == 2u);
+        CHECK(&*begin(*(it + 2)) == &v[6]);
+        ::check_equal(*(end(rng) - 1), {9, 10});
+        CHECK((end(rng) - it) == 4);
+        auto rev = rng | view::reverse;
+        ::check_equal(*begin(rev), {9, 10});
+        ::check_equal(*next(begin(rev)), {6, 7, 8});
+        CHECK((v | view::chunk(11)).size() == 1u);
+        CHECK((v | view::chunk(12)).size() == 1u);
+        std::vector<int> none;
+        CHECK((none | view::chunk(4)).size() == 0u);
+        CHECK(begin(none | view::chunk(4)) == end(none | view::chunk(4)));
+        // Chunks can be written through.
+        for(auto &&c : view::chunk(v, 4))
+            *begin(c) += 100;
+        ::check_equal(v, {100, 1, 2, 3, 104, 5, 6, 7, 108, 9, 10});
+    }
+
+    // A chunk size larger than the range makes one chunk of the whole range,
+    // even when it is too large to be added to the range's size.
+    {
+        std::vector<int> w{0, 1, 2, 3, 4};
+        auto const big = std::numeric_limits<std::ptrdiff_t>::max();
+        auto rng = w | view::chunk(big);
+        CHECK(rng.size() == 1u);
+        CHECK((end(rng) - begin(rng)) == 1);
+        ::check_equal(*begin(rng), {0, 1, 2, 3, 4});
+        std::list<int> lw(w.begin(), w.end());
+        auto lrng = lw | view::chunk(big);
+        CHECK(distance(lrng) == 1);
+        ::check_equal(*begin(lrng), {0, 1, 2, 3, 4});
+    }
+
+    // Chunks of other forward ranges are found as the iterator reaches them.
+    {
+        std::list<int> li(v.begin(), v.end());
+        auto rng = li | view::chunk(4);
+        ::models<concepts::ForwardRange>(rng);
+        ::models_not<concepts::BidirectionalRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 3u);
+        auto it = begin(rng);
+        ::check_equal(*it, {100, 1, 2, 3});
+        ++it;
+        ::check_equal(*it, {104, 5, 6, 7});
+        ++it;
+        ::check_equal(*it, {108, 9, 10});
+        CHECK(size(*it) == 3u);
+        ++it;
+        CHECK(it == end(rng));
+
+        auto evens = li | view::remove_if([](int i) { return i % 2 == 1; });
+        auto rng2 = evens | view::chunk(2);
+        ::models_not<concepts::SizedRange>(rng2);
+        auto it2 = begin(rng2);
+        ::check_equal(*it2++, {100, 2});
+        ::check_equal(*it2++, {104, 6});
+        ::check_equal(*it2++, {108, 10});
+        CHECK(it2 == end(rng2));
+
+        std::forward_list<int> fl{1, 2, 3};
+        CHECK(distance(fl | view::chunk(2)) == 2);
+        auto inf = view::ints(0) | view::chunk(5);
+        CONCEPT_ASSERT(is_infinite<decltype(inf)>());
+        ::check_equal(*next(begin(inf), 2), {10, 11, 12, 13, 14});
+    }
+
+    // An input range is buffered a chunk at a time.
+    {
+        std::stringstream sin{"1 2 3 4 5 6 7"};
+        auto rng = istream<int>(sin) | view::chunk(3);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, range<int *>>());
+        std::vector<std::vector<int>> chunks;
+        RANGES_FOR(auto &&c, rng)
+            chunks.emplace_back(c.begin(), c.end());
+        CHECK(chunks.size() == 3u);
+        ::check_equal(chunks[0], {1, 2, 3});
+        ::check_equal(chunks[1], {4, 5, 6});
+        ::check_equal(chunks[2], {7});
+
+        std::stringstream empty{""};
+        auto rng2 = istream<int>(empty) | view::chunk(3);
+        CHECK(begin(rng2) == end(rng2));
+    }
+
+    return test_result();
+}
@@ -73,5 +73,10 @@ int main()
     ::check_equal(rng5, {29, 28, 27, 26, 25, 24, 23, 22, 21, 20});
     CHECK(size(rng5) == 10u);
 
+    // A drop of a drop is fused.
+    auto rng6 = view::iota(10) | view::drop(5) | view::drop(5) | view::take(10) | view::take(3);
+    CONCEPT_ASSERT(Same<decltype(rng6), take_view<drop_view<iota_view<int>>>>());
+    ::check_equal(rng6, {20, 21, 22});
+
     return test_result();
 }
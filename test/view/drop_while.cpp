@@ -45,5 +45,12 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_only)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_only) const>());
 
+    // Either caching policy
+    auto rng2 = vi | view::drop_while([](int i) { return i < 7; }, single_threaded_cache{});
+    ::check_equal(rng2, {7, 8, 9});
+    auto rng3 = view::drop_while(vi, [](int i) { return i < 8; }, shared_cache{});
+    ::check_equal(rng3, {8, 9});
+    CHECK(&*rng3.begin() == &*std::prev(vi.end(), 2));
+
     return test_result();
 }
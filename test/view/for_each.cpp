@@ -0,0 +1,85 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <tuple>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{1, 2, 3, 4, 5, 6};
+
+    // yield_if is a filter and a transform in one.
+    {
+        int calls = 0;
+        auto rng = v | view::for_each([&](int i)
+        {
+            ++calls;
+            return yield_if(i % 2 == 0, i * 10);
+        });
+        ::models<concepts::ForwardRange>(rng);
+        ::models_not<concepts::BidirectionalRange>(rng);
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, int>());
+        ::check_equal(rng, {20, 40, 60});
+        CHECK(calls == 6);
+        CHECK(distance(rng) == 3);
+
+        std::list<int> li(v.begin(), v.end());
+        auto none = li | view::for_each([](int i) { return yield_if(i > 6, i); });
+        CHECK(begin(none) == end(none));
+
+        auto squares = view::ints(1) | view::for_each([](int i) { return yield(i * i); });
+        ::check_equal(squares | view::take(4), {1, 4, 9, 16});
+    }
+
+    // The Pythagorean triples, from nested for_each.
+    {
+        auto triples =
+            view::for_each(view::ints(1), [](int z)
+            {
+                return view::for_each(view::ints(1, z), [=](int x)
+                {
+                    return view::for_each(view::ints(x, z), [=](int y)
+                    {
+                        return yield_if(x*x + y*y == z*z, std::make_tuple(x, y, z));
+                    });
+                });
+            });
+        std::vector<std::tuple<int, int, int>> found;
+        RANGES_FOR(auto triple, triples | view::take(3))
+            found.push_back(triple);
+        CHECK(found.size() == 3u);
+        CHECK(found[0] == std::make_tuple(3, 4, 5));
+        CHECK(found[1] == std::make_tuple(6, 8, 10));
+        CHECK(found[2] == std::make_tuple(5, 12, 13));
+    }
+
+    // Other ranges are joined.
+    {
+        auto rng = v | view::take(3) | view::for_each([](int i)
+        {
+            return yield_from(view::repeat_n(i, i));
+        });
+        ::check_equal(rng, {1, 2, 2, 3, 3, 3});
+    }
+
+    return test_result();
+}
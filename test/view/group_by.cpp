@@ -14,6 +14,10 @@
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/group_by.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/algorithm/equal.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -76,5 +80,79 @@ int main()
         check_equal(*next(rng1.begin()), {P{2,2},P{2,2},P{2,3},P{2,3},P{2,3},P{2,3}});
     }
 
+    // Groups are found lazily, so the first group can be infinite
+    {
+        auto rng = view::ints(0) | view::group_by([](int, int) {return true;});
+        check_equal(*rng.begin() | view::take(3), {0, 1, 2});
+    }
+
+    {
+        // Over forward iterators, the predicate is called once per element after
+        // the first of each group, and the groups are sized
+        forward_iterator<std::vector<P>::iterator> b{v.begin()};
+        int calls = 0;
+        auto rng = view::counted(b, v.size())
+            | view::group_by_sorted([&](P p0, P p1) {++calls; return p0.first == p1.first;});
+        auto it = rng.begin();
+        CHECK(calls == 6);
+        CHECK(size(*it) == 6u);
+        ++it;
+        CHECK(calls == 11);
+        ++it;
+        CHECK(it == rng.end());
+        CHECK(calls == 11);
+
+        auto rng2 = view::counted(b, v.size())
+            | view::group_by_sorted([](P p0, P p1) {return p0.second == p1.second;});
+        ::models<concepts::SizedIterable>(*rng2.begin());
+        CHECK(size(*next(rng2.begin())) == 6u);
+    }
+
+    {
+        auto rng0 = v | view::group_by_sorted([](P p0, P p1) {return p0.second == p1.second;});
+        CHECK(distance(rng0) == 3);
+        check_equal(*rng0.begin(), {P{1,1},P{1,1}});
+        check_equal(*next(rng0.begin()), {P{1,2},P{1,2},P{1,2},P{1,2},P{2,2},P{2,2}});
+        check_equal(*next(rng0.begin(), 2), {P{2,3},P{2,3},P{2,3},P{2,3}});
+
+        // Long groups are found in a logarithmic number of calls
+        std::vector<int> w(1000, 1);
+        w.resize(1001, 2);
+        int calls = 0;
+        auto rng1 = w | view::group_by_sorted([&](int i, int j) {++calls; return i == j;});
+        CHECK(distance(rng1) == 2);
+        CHECK(calls < 40);
+        CHECK(size(*rng1.begin()) == 1000u);
+        CHECK(size(*next(rng1.begin())) == 1u);
+
+        for(std::size_t n = 0; n < 40; ++n)
+        {
+            std::vector<int> x;
+            for(std::size_t i = 0; i < n; ++i)
+                x.push_back((int)(i * i / 7));
+            auto sorted = x | view::group_by_sorted(std::equal_to<int>());
+            auto linear = x | view::group_by(std::equal_to<int>());
+            CHECK(distance(sorted) == distance(linear));
+            auto i = sorted.begin();
+            for(auto j = linear.begin(); j != linear.end() && i != sorted.end(); ++i, ++j)
+                CHECK(equal(*i, *j));
+        }
+    }
+
+    // Over view::zip
+    {
+        std::vector<int> k{1,1,1,2,2,3,3,3,3,3,4};
+        std::vector<char> c(k.size(), 'x');
+        auto rng = view::zip(k, c) | view::group_by_sorted(firsts_equal());
+        CHECK(distance(rng) == 4);
+        auto i = rng.begin();
+        CHECK(size(*i) == 3u);
+        CHECK(size(*++i) == 2u);
+        CHECK(size(*++i) == 5u);
+        CHECK((*(*i).begin()).first == 3);
+        CHECK(size(*++i) == 1u);
+        CHECK(++i == rng.end());
+    }
+
     return test_result();
 }
@@ -0,0 +1,65 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/memoize.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8};
+    int calls = 0;
+    auto square = [&](int i) { ++calls; return i * i; };
+
+    auto rng = v | view::transform(square) | view::memoize;
+    ::models<concepts::RandomAccessRange>(rng);
+    ::models<concepts::BoundedRange>(rng);
+    ::models<concepts::SizedRange>(rng);
+    CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, int const &>());
+    CHECK(rng.size() == 8u);
+    CHECK(calls == 0);
+
+    // Each element is computed once, whichever iterator reads it.
+    ::check_equal(rng | view::reverse, {64, 49, 36, 25, 16, 9, 4, 1});
+    CHECK(calls == 8);
+    ::check_equal(rng, {1, 4, 9, 16, 25, 36, 49, 64});
+    CHECK(*lower_bound(rng, 30) == 36);
+    CHECK(calls == 8);
+
+    // Only the elements that are read are computed, and copies of the view
+    // share what has been.
+    calls = 0;
+    auto rng2 = v | view::transform(square) | view::memoize;
+    CHECK(*(begin(rng2) + 5) == 36);
+    CHECK(*lower_bound(rng2, 30) == 36);
+    CHECK(calls == 3);
+    auto copy = rng2;
+    CHECK(*(begin(copy) + 5) == 36);
+    CHECK(calls == 3);
+
+    // A default-constructed view is empty and can be iterated.
+    {
+        memoize_view<range<int *>> m{};
+        CHECK(begin(m) == end(m));
+        CHECK(m.size() == 0u);
+        m = view::memoize(range<int *>{v.data(), v.data() + 3});
+        ::check_equal(m, {1, 2, 3});
+    }
+
+    return test_result();
+}
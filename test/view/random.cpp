@@ -0,0 +1,106 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <range/v3/core.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/random.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/all_of.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // Known answers for Philox4x32-10, from the Random123 distribution
+    {
+        std::uint32_t ctr[4] = {0, 0, 0, 0};
+        detail::philox4x32_10(ctr, 0, 0);
+        CHECK(ctr[0] == 0x6627e8d5u);
+        CHECK(ctr[1] == 0xe169c58du);
+        CHECK(ctr[2] == 0xbc57ac4cu);
+        CHECK(ctr[3] == 0x9b00dbd8u);
+        std::uint32_t ctr2[4] = {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u};
+        detail::philox4x32_10(ctr2, 0xa4093822u, 0x299f31d0u);
+        CHECK(ctr2[0] == 0xd16cfe09u);
+        CHECK(ctr2[1] == 0x94fdccebu);
+        CHECK(ctr2[2] == 0x5001e420u);
+        CHECK(ctr2[3] == 0x24126ea1u);
+    }
+
+    {
+        auto rng = view::random(42);
+        ::models<concepts::Range>(rng);
+        ::models_not<concepts::BoundedRange>(rng);
+        ::models<concepts::RandomAccessIterator>(rng.begin());
+        CHECK(is_infinite<decltype(rng)>());
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, std::uint64_t>());
+
+        // Elements depend on the index alone
+        auto it = rng.begin();
+        std::uint64_t const x5 = it[5];
+        CHECK(*(it + 5) == x5);
+        CHECK(*next(it, 5) == x5);
+        CHECK(it[5] == x5);
+        CHECK(it[4] != x5);
+        CHECK(view::random(43).begin()[5] != x5);
+        CHECK(view::random(42).begin()[5] == x5);
+    }
+
+    // Bounded with view::take, it is sized and random-access, and reading it
+    // backward or in parts gives the same values as reading it forward.
+    {
+        auto rng = view::random(7, std::uniform_int_distribution<int>{-3, 3}) | view::take(1000);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::RandomAccessIterator>(rng.begin());
+        CHECK(size(rng) == 1000u);
+        CHECK(all_of(rng, [](int i) { return i >= -3 && i <= 3; }));
+
+        std::vector<int> forward = rng;
+        std::vector<int> backward(1000);
+        for(int i = 999; i >= 0; --i)
+            backward[i] = rng.begin()[i];
+        CHECK(forward == backward);
+        auto tail = rng | view::drop(500);
+        CHECK(equal(tail, make_range(forward.begin() + 500, forward.end())));
+        ::check_equal(rng | view::reverse | view::take(3), {forward[999], forward[998], forward[997]});
+
+        int counts[7] = {};
+        for(int i : forward)
+            ++counts[i + 3];
+        for(int c : counts)
+            CHECK((c > 100 && c < 190));
+    }
+
+    // Distributions that keep state between calls still give each element
+    // from its index alone.
+    {
+        auto rng = view::random(1, std::normal_distribution<double>{10.0, 2.0});
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, double>());
+        auto it = rng.begin();
+        double const x1 = it[1];
+        double const x0 = it[0];
+        CHECK(it[1] == x1);
+        CHECK(*it == x0);
+        double sum = 0;
+        for(auto const x : rng | view::take(10000))
+            sum += x;
+        CHECK((sum / 10000 > 9.9 && sum / 10000 < 10.1));
+    }
+
+    return test_result();
+}
@@ -9,6 +9,9 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
@@ -78,5 +81,49 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_rng)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_rng) const>());
 
+    // With a shared cache, threads that ask for the begin at once find it once.
+    {
+        int evens_first[] = {2, 4, 6, 8, 1, 3, 10, 5};
+        std::atomic<int> calls{0};
+        auto counting_is_even = [&](int i) { ++calls; return i % 2 == 0; };
+        auto shared = evens_first | view::remove_if(counting_is_even, shared_cache{});
+        CONCEPT_ASSERT(Same<decltype(shared), remove_if_view<range<int *>,
+            decltype(counting_is_even), shared_cache>>());
+        std::vector<int *> begins(4);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; ++t)
+            threads.emplace_back([&, t] { begins[t] = &*begin(shared); });
+        for(auto &th : threads)
+            th.join();
+        CHECK(calls == 5);
+        for(int *p : begins)
+            CHECK(p == &evens_first[4]);
+        ::check_equal(shared, {1, 3, 5});
+        auto copy = shared;
+        CHECK(&*begin(copy) == &evens_first[4]);
+        CHECK(calls > 5);
+    }
+
+    // A remove_if of a remove_if is one, with the predicates combined.
+    {
+        int calls = 0;
+        auto is_odd = [&](int i) { ++calls; return i % 2 == 1; };
+        auto is_big = [&](int i) { ++calls; return i > 6; };
+        auto rng2 = rgi | view::remove_if(is_odd) | view::remove_if(is_big);
+        CONCEPT_ASSERT(Same<decltype(rng2), remove_if_view<range<int *>,
+            detail::either_of_<decltype(is_odd), decltype(is_big)>>>());
+        ::check_equal(rng2, {2, 4, 6});
+        // The second predicate is asked only about the elements the first keeps.
+        CHECK(calls == 10 + 5);
+
+        auto shared = rgi | view::remove_if(is_odd, shared_cache{})
+            | view::remove_if(is_big, shared_cache{});
+        CONCEPT_ASSERT(Same<decltype(shared), remove_if_view<range<int *>,
+            detail::either_of_<decltype(is_odd), decltype(is_big)>, shared_cache>>());
+        ::check_equal(shared, {2, 4, 6});
+        ::check_equal(rgi | view::remove_if(is_odd, shared_cache{}) | view::remove_if(is_big),
+            {2, 4, 6});
+    }
+
     return test_result();
 }
@@ -0,0 +1,59 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/search_all.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::string str("abababa");
+        std::string pat("aba");
+        auto rng = view::search_all(str, pat);
+        CONCEPT_ASSERT(ForwardIterable<decltype(rng)>());
+        auto positions = rng | view::transform([&](range<std::string::iterator> r)
+        {
+            return r.begin() - str.begin();
+        });
+        check_equal(positions, {0, 2, 4});
+        check_equal(*begin(rng), pat);
+        CHECK(size(*begin(rng)) == 3u);
+    }
+
+    {
+        std::string str("the cat sat on the mat");
+        auto bmh = str | view::search_all(make_boyer_moore_horspool_searcher(std::string("at")));
+        CHECK(distance(bmh) == 3);
+        auto tw = str | view::search_all(make_two_way_searcher(std::string("the")));
+        CHECK(distance(tw) == 2);
+        CHECK(distance(view::search_all(str, std::string("dog"))) == 0);
+        CHECK(distance(view::search_all(str, std::string("the cat sat on the mat!"))) == 0);
+    }
+
+    {
+        // Forward ranges of non-byte elements
+        std::list<int> l{1, 1, 1, 2, 1, 1};
+        std::vector<int> pat{1, 1};
+        auto rng = view::search_all(l, pat);
+        CHECK(distance(rng) == 3);
+        CHECK(distance(*begin(rng)) == 2);
+    }
+
+    return test_result();
+}
@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <list>
+#include <thread>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -122,5 +123,29 @@ int main()
         ::check_equal(letters[{2,end-2}], {'c','d','e'});
     }
 
+    // Without random access, the begin is kept in the given cache.
+    {
+        auto rng0 = l | view::slice(2, 5);
+        CONCEPT_ASSERT(Same<decltype(rng0), slice_view<view::all_t<std::list<int> &>>>());
+        auto rng1 = l | view::slice(2, 5, shared_cache{});
+        CONCEPT_ASSERT(Same<decltype(rng1),
+            slice_view<view::all_t<std::list<int> &>, shared_cache>>());
+        ::check_equal(rng1, {2, 3, 4});
+        auto rng2 = view::slice(l, end - 3, end - 1, shared_cache{});
+        std::vector<int *> begins(4);
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; ++t)
+            threads.emplace_back([&, t] { begins[t] = &*begin(rng2); });
+        for(auto &th : threads)
+            th.join();
+        for(int *p : begins)
+            CHECK(p == &*std::next(l.begin(), 8));
+        ::check_equal(rng2, {8, 9});
+        ::check_equal(l | view::slice(end - 2, end, single_threaded_cache{}), {9, 10});
+        ::check_equal(view::slice(l, 1, end - 8, shared_cache{}), {1, 2});
+        auto copy = rng1;
+        ::check_equal(copy, {2, 3, 4});
+    }
+
     return test_result();
 }
@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <vector>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{0, 1, 2, 3, 4, 5};
+
+    // Windows of a sized random-access range are found from their index.
+    {
+        auto rng = v | view::sliding(3);
+        ::models<concepts::RandomAccessRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::BoundedRange>(rng);
+        CONCEPT_ASSERT(RandomAccessRange<decltype(rng) const>());
+        CHECK(rng.size() == 4u);
+        CHECK(distance(rng) == 4);
+        auto it = begin(rng);
+        ::check_equal(*it, {0, 1, 2});
+        ::check_equal(*(it + 3), {3, 4, 5});
+        CHECK(size(*(it + 3)) == 3u);
+        CHECK(&*begin(*(it + 2)) == &v[2]);
+        CHECK((end(rng) - it) == 4);
+        auto rev = rng | view::reverse;
+        ::check_equal(*begin(rev), {3, 4, 5});
+        ::check_equal(*next(begin(rev)), {2, 3, 4});
+        CHECK((v | view::sliding(1)).size() == 6u);
+        CHECK((v | view::sliding(6)).size() == 1u);
+        CHECK((v | view::sliding(7)).size() == 0u);
+        CHECK(begin(v | view::sliding(7)) == end(v | view::sliding(7)));
+        std::vector<int> none;
+        CHECK((none | view::sliding(2)).size() == 0u);
+    }
+
+    // Windows of other forward ranges keep their first and last element.
+    {
+        std::list<int> li(v.begin(), v.end());
+        auto rng = li | view::sliding(4);
+        ::models<concepts::ForwardRange>(rng);
+        ::models_not<concepts::BidirectionalRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        CHECK(rng.size() == 3u);
+        auto it = begin(rng);
+        ::check_equal(*it, {0, 1, 2, 3});
+        CHECK(size(*it) == 4u);
+        ++it;
+        ::check_equal(*it, {1, 2, 3, 4});
+        ++it;
+        ::check_equal(*it, {2, 3, 4, 5});
+        ++it;
+        CHECK(it == end(rng));
+
+        auto odds = li | view::remove_if([](int i) { return i % 2 == 0; });
+        auto rng2 = odds | view::sliding(2);
+        ::models_not<concepts::SizedRange>(rng2);
+        auto it2 = begin(rng2);
+        ::check_equal(*it2++, {1, 3});
+        ::check_equal(*it2++, {3, 5});
+        CHECK(it2 == end(rng2));
+        CHECK(begin(odds | view::sliding(4)) == end(odds | view::sliding(4)));
+
+        std::forward_list<int> fl{1, 2, 3};
+        CHECK(distance(fl | view::sliding(2)) == 2);
+        CHECK(distance(fl | view::sliding(3)) == 1);
+        CHECK(distance(fl | view::sliding(4)) == 0);
+        std::forward_list<int> empty;
+        CHECK(distance(empty | view::sliding(1)) == 0);
+
+        auto inf = view::ints(0) | view::sliding(3);
+        CONCEPT_ASSERT(is_infinite<decltype(inf)>());
+        ::check_equal(*next(begin(inf), 10), {10, 11, 12});
+    }
+
+    return test_result();
+}
@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/split.hpp>
@@ -127,5 +128,74 @@ int main()
         }
     }
 
+    {
+        // Multi-character delimiters, with partial matches and delimiters at
+        // both ends; the elements are sized
+        std::string str("--a-b---c--");
+        auto rng = view::split(str, c_str("--"));
+        ::models<concepts::SizedRange>(*begin(rng));
+        CHECK(distance(rng) == 3);
+        if(distance(rng) == 3)
+        {
+            CHECK(size(*(next(begin(rng),0))) == 0u);
+            check_equal(*(next(begin(rng),1)), c_str("a-b"));
+            check_equal(*(next(begin(rng),2)), c_str("-c"));
+        }
+        std::string dashes("---");
+        CHECK(distance(view::split(str, dashes)) == 2);
+        CHECK(distance(view::split(str, c_str("xyzzy"))) == 1);
+    }
+
+    {
+        // Non-byte elements, and a delimiter pattern longer than the input
+        std::vector<int> v{1, 0, 2, 3, 0, 0, 4};
+        auto rng = view::split(v, 0);
+        CHECK(distance(rng) == 4);
+        if(distance(rng) == 4)
+        {
+            check_equal(*(next(begin(rng),0)), {1});
+            check_equal(*(next(begin(rng),1)), {2, 3});
+            CHECK(empty(*(next(begin(rng),2))));
+            check_equal(*(next(begin(rng),3)), {4});
+        }
+        std::vector<int> pat{0, 0};
+        auto rng2 = view::split(v, pat);
+        CHECK(distance(rng2) == 2);
+        if(distance(rng2) == 2)
+        {
+            check_equal(*(next(begin(rng2),0)), {1, 0, 2, 3});
+            check_equal(*(next(begin(rng2),1)), {4});
+        }
+        std::vector<int> long_pat(10, 0);
+        CHECK(distance(view::split(v, long_pat)) == 1);
+    }
+
+    {
+        // Forward iterators, searched element by element
+        std::string str("a,b,,c");
+        forward_iterator<std::string::iterator> i {str.begin()};
+        auto rng = view::counted(i, str.size()) | view::split(',');
+        CHECK(distance(rng) == 4);
+        auto rng2 = view::counted(i, str.size()) | view::split(c_str(",,"));
+        CHECK(distance(rng2) == 2);
+        if(distance(rng2) == 2)
+            check_equal(*(next(begin(rng2),1)), c_str("c"));
+    }
+
+    {
+        // Searcher objects as delimiters
+        std::string str("a<>b<><>c");
+        auto rng = view::split(str, make_two_way_searcher(std::string("<>")));
+        CHECK(distance(rng) == 4);
+        if(distance(rng) == 4)
+        {
+            check_equal(*(next(begin(rng),0)), c_str("a"));
+            check_equal(*(next(begin(rng),1)), c_str("b"));
+            CHECK(empty(*(next(begin(rng),2))));
+            check_equal(*(next(begin(rng),3)), c_str("c"));
+        }
+        CHECK(distance(str | view::split(make_boyer_moore_horspool_searcher(c_str("<>")))) == 4);
+    }
+
     return test_result();
 }
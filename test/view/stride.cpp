@@ -16,6 +16,7 @@
 #include <range/v3/istream_range.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/remove_if.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/numeric.hpp>
@@ -64,5 +65,26 @@ int main()
     CHECK((it0 - it0) == 0);
     CHECK((it1 - it1) == 0);
 
+    // Either caching policy, over a bidirectional range of unknown size, whose
+    // iterators need both the offset and the dirty flag.
+    {
+        auto odd = [](int i) { return i % 2 == 1; };
+        auto evens = li | view::remove_if(odd);
+        CONCEPT_ASSERT(!SizedIterable<decltype(evens)>());
+        auto x3 = evens | view::stride(4, single_threaded_cache{});
+        CONCEPT_ASSERT(Same<decltype(x3),
+            stride_view<decltype(evens), single_threaded_cache>>());
+        ::check_equal(x3 | view::reverse, {48, 40, 32, 24, 16, 8, 0});
+        ::check_equal(view::stride(evens, 4, shared_cache{}) | view::reverse,
+            {48, 40, 32, 24, 16, 8, 0});
+        auto x4 = view::stride(v, 3, single_threaded_cache{});
+        CONCEPT_ASSERT(!Same<decltype(x4), decltype(view::stride(v, 3))>());
+        CONCEPT_ASSERT(Same<decltype(x2), stride_view<decltype(view::all(v)), shared_cache>>());
+        static_assert(sizeof(x4.begin()) == sizeof(x2.begin()), "");
+        ::check_equal(x4 | view::reverse,
+            {48, 45, 42, 39, 36, 33, 30, 27, 24, 21, 18, 15, 12, 9, 6, 3, 0});
+        CHECK((std::next(x4.begin(), 10) - x4.begin()) == 10);
+    }
+
     return ::test_result();
 }
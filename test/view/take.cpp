@@ -71,5 +71,16 @@ int main()
     ::check_equal(rng5, {19, 18, 17, 16, 15, 14, 13, 12, 11, 10});
     CHECK(size(rng5) == 10u);
 
+    // A take of a take, and a reverse of a reverse, are fused.
+    auto rng6 = view::iota(10) | view::take(10) | view::take(3) | view::take(5);
+    CONCEPT_ASSERT(Same<decltype(rng6), take_view<iota_view<int>>>());
+    ::check_equal(rng6, {10, 11, 12});
+    CHECK(size(rng6) == 3u);
+    auto rng7 = rng4 | view::reverse | view::take(2) | view::reverse | view::reverse;
+    CONCEPT_ASSERT(Same<decltype(rng7), take_view<reverse_view<decltype(rng4)>>>());
+    ::check_equal(rng7, {19, 18});
+    CONCEPT_ASSERT(Same<decltype(rng4 | view::reverse | view::reverse), decltype(rng4)>());
+    ::check_equal(rng4 | view::reverse | view::reverse, rng4);
+
     return test_result();
 }
@@ -0,0 +1,60 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/top_k.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{9, 3, 7, 1, 8, 2, 6, 0, 5, 4};
+    auto rng = v | view::top_k(3);
+    CONCEPT_ASSERT(RandomAccessRange<decltype(rng)>());
+    CONCEPT_ASSERT(BoundedRange<decltype(rng)>());
+    ::check_equal(rng, {0, 1, 2});
+    CHECK(rng.size() == 3u);
+    ::check_equal(view::top_k(v, 3, std::greater<int>()), {9, 8, 7});
+
+    // Copies share the result
+    auto rng2 = rng;
+    ::check_equal(rng2, {0, 1, 2});
+
+    // Single-pass source, evaluated only once
+    std::stringstream sin{"5 9 2 7 1 8 3 6 4 0"};
+    auto top = istream<int>(sin) | view::top_k(4, std::greater<int>());
+    ::check_equal(top, {9, 8, 7, 6});
+    ::check_equal(top, {9, 8, 7, 6});
+
+    // Copies made before the first begin() share the one evaluation
+    std::stringstream sin2{"5 9 2 7 1 8 3 6 4 0"};
+    auto top2 = istream<int>(sin2) | view::top_k(4, std::greater<int>());
+    auto top3 = top2;
+    ::check_equal(top3, {9, 8, 7, 6});
+    ::check_equal(top2, {9, 8, 7, 6});
+
+    // Lazy source with a projection
+    auto sq = view::iota(-50) | view::take(101) | view::transform([](int i){return i * i;});
+    ::check_equal(sq | view::top_k(5), {0, 1, 1, 4, 4});
+    ::check_equal(sq | view::top_k(2, std::greater<int>(), [](int i){return -i;}), {0, 1});
+
+    return test_result();
+}
@@ -119,5 +119,24 @@ int main()
         CONCEPT_ASSERT(Same<range_rvalue_reference_t<R2>, std::string &&>());
     }
 
+    // A transform of a transform is one, by the composed function.
+    {
+        int rgi[] = {1, 2, 3, 4};
+        auto rng = rgi | view::transform([](int i) { return i * 10; })
+            | view::transform([](int i) { return i + 1; })
+            | view::transform([](int i) { return std::to_string(i); });
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, std::string>());
+        CONCEPT_ASSERT(Same<decltype(rng.base()), range<int *> &>());
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::RandomAccessIterator>(begin(rng));
+        ::check_equal(rng, {"11", "21", "31", "41"});
+
+        auto first = view::transform(rgi, [](int &i) -> int & { return i; });
+        auto refs = view::transform(first, [](int &i) -> int & { return ++i; });
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(refs)>, int &>());
+        CHECK(&*begin(refs) == &rgi[0]);
+        ::check_equal(rgi, {2, 2, 3, 4});
+    }
+
     return test_result();
 }
@@ -21,6 +21,8 @@
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/bounded.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/move.hpp>
@@ -129,6 +131,38 @@ int main()
     CHECK((rnd_rng.begin() - rnd_rng.end()) == -4);
     CHECK(rnd_rng.size() == 4u);
 
+    // Sized random-access ranges are zipped by a single index, which stops
+    // at the shortest of them.
+    {
+        std::vector<int> a{1, 2, 3, 4, 5};
+        std::vector<long> b{10, 20, 30, 40, 50, 60, 70};
+        int c[] = {0, 0, 0, 0, 0, 0};
+        auto rng = view::zip(a, b, c);
+        ::models<concepts::BoundedRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::RandomAccessIterator>(begin(rng));
+        CHECK(rng.size() == 5u);
+        CHECK((end(rng) - begin(rng)) == 5);
+        for(auto &&t : rng)
+            std::get<2>(t) = std::get<0>(t) + static_cast<int>(std::get<1>(t));
+        ::check_equal(c, {11, 22, 33, 44, 55, 0});
+        CHECK(std::get<1>(*(begin(rng) + 4)) == 50);
+        CHECK(std::get<0>(*(end(rng) - 1)) == 5);
+        ::check_equal(rng | view::reverse | view::transform([](range_value_t<decltype(rng)> t)
+        {
+            return std::get<2>(t);
+        }), {55, 44, 33, 22, 11});
+
+        // A sized range whose end is a sentinel
+        auto rng2 = view::zip(a | view::take(3), b);
+        ::models<concepts::BoundedRange>(rng2);
+        CHECK(rng2.size() == 3u);
+        int sum = 0;
+        for(auto &&p : rng2)
+            sum += p.first;
+        CHECK(sum == 6);
+    }
+
     // zip_with
     {
         std::vector<std::string> v0{"a","b","c"};